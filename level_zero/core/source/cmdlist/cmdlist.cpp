@@ -26,6 +26,8 @@
 
 namespace L0 {
 
+std::atomic<uint64_t> CommandList::stateTrackingIdCounter{0};
+
 CommandList::~CommandList() {
     if (cmdQImmediate) {
         cmdQImmediate->destroy();
@@ -155,7 +157,29 @@ void CommandList::eraseResidencyContainerEntry(NEO::GraphicsAllocation *allocati
     allocErase = std::find(container->begin(), container->end(), allocation);
     if (allocErase != container->end()) {
         container->erase(allocErase);
+        invalidateResidencySet();
+    }
+}
+
+bool CommandList::isResidencySetCacheEnabled() {
+    return NEO::debugManager.flags.EnableCommandListResidencySetCache.get() == 1;
+}
+
+CommandListResidencySet &CommandList::getResidencySet() {
+    auto &residencyContainer = commandContainer.getResidencyContainer();
+    if (residencySet.version != residencySetVersion || residencySet.residencyContainerSize != residencyContainer.size()) {
+        residencySet.migratableAllocations.clear();
+        for (auto alloc : residencyContainer) {
+            if (alloc->getAllocationType() == NEO::AllocationType::svmGpu ||
+                alloc->getAllocationType() == NEO::AllocationType::svmCpu) {
+                residencySet.migratableAllocations.push_back(alloc);
+            }
+        }
+        residencySet.version = residencySetVersion;
+        residencySet.residencyContainerSize = residencyContainer.size();
+        residencySet.lastMergeId = 0;
     }
+    return residencySet;
 }
 
 void CommandList::migrateSharedAllocations() {
@@ -22,6 +22,7 @@
 #include <level_zero/ze_api.h>
 #include <level_zero/zet_api.h>
 
+#include <atomic>
 #include <map>
 #include <unordered_map>
 #include <vector>
@@ -41,6 +42,15 @@ struct CmdListReturnPoint {
     NEO::GraphicsAllocation *currentCmdBuffer = nullptr;
 };
 
+// Residency of a closed command list cached between submissions.
+// Rebuilt when the list is reset, closed after appends or its residency container changes.
+struct CommandListResidencySet {
+    NEO::ResidencyContainer migratableAllocations;
+    uint64_t lastMergeId = 0;
+    uint64_t version = 0;
+    size_t residencyContainerSize = 0;
+};
+
 struct CommandList : _ze_command_list_handle_t {
     static constexpr uint32_t defaultNumIddsPerBlock = 64u;
     static constexpr uint32_t commandListimmediateIddsPerBlock = 1u;
@@ -116,6 +126,7 @@ struct CommandList : _ze_command_list_handle_t {
                                          ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
                                          ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) = 0;
     virtual ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t size, bool flushHost) = 0;
+    virtual ze_result_t appendPageFaultRangeCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t offset, size_t size, bool flushHost) = 0;
     virtual ze_result_t appendMemoryCopyRegion(void *dstPtr,
                                                const ze_copy_region_t *dstRegion,
                                                uint32_t dstPitch,
@@ -336,6 +347,20 @@ struct CommandList : _ze_command_list_handle_t {
         return dispatchCmdListBatchBufferAsPrimary;
     }
 
+    static bool isResidencySetCacheEnabled();
+    CommandListResidencySet &getResidencySet();
+    void invalidateResidencySet() {
+        residencySetVersion++;
+    }
+    // Id of state tracking results of the command list, taken from process wide counter when the list is created,
+    // reset or closed, so it never repeats for a different list or content.
+    uint64_t getStateTrackingId() const {
+        return stateTrackingId;
+    }
+    void updateStateTrackingId() {
+        stateTrackingId = ++stateTrackingIdCounter;
+    }
+
   protected:
     NEO::GraphicsAllocation *getAllocationFromHostPtrMap(const void *buffer, uint64_t bufferSize);
     NEO::GraphicsAllocation *getHostPtrAlloc(const void *buffer, uint64_t bufferSize, bool hostCopyAllowed);
@@ -360,6 +385,7 @@ struct CommandList : _ze_command_list_handle_t {
     CommandsToPatch commandsToPatch{};
     UnifiedMemoryControls unifiedMemoryControls;
     NEO::PrefetchContext prefetchContext;
+    CommandListResidencySet residencySet;
     NEO::L1CachePolicy l1CachePolicyData{};
     NEO::EncodeDummyBlitWaArgs dummyBlitWa{};
 
@@ -375,6 +401,9 @@ struct CommandList : _ze_command_list_handle_t {
 
     size_t minimalSizeForBcsSplit = 4 * MemoryConstants::megaByte;
     size_t cmdListCurrentStartOffset = 0;
+    uint64_t residencySetVersion = 1;
+    uint64_t stateTrackingId = 0;
+    static std::atomic<uint64_t> stateTrackingIdCounter;
     size_t maxFillPaternSizeForCopyEngine = 0;
 
     ze_command_list_flags_t flags = 0u;
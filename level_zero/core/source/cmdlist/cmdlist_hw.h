@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -132,6 +132,11 @@ struct CommandListCoreFamily : public CommandListImp {
                                     NEO::GraphicsAllocation *srcAllocation,
                                     size_t size,
                                     bool flushHost) override;
+    ze_result_t appendPageFaultRangeCopy(NEO::GraphicsAllocation *dstAllocation,
+                                         NEO::GraphicsAllocation *srcAllocation,
+                                         size_t offset,
+                                         size_t size,
+                                         bool flushHost) override;
     ze_result_t appendMemoryCopyRegion(void *dstPtr,
                                        const ze_copy_region_t *dstRegion,
                                        uint32_t dstPitch,
@@ -258,6 +263,7 @@ struct CommandListCoreFamily : public CommandListImp {
                                                          const ze_group_count_t &threadGroupDimensions,
                                                          Event *event,
                                                          const CmdListKernelLaunchParams &launchParams);
+    void appendPredictiveMemoryPrefetch(Kernel *kernel);
 
     ze_result_t appendUnalignedFillKernel(bool isStateless,
                                           uint32_t unalignedSize,
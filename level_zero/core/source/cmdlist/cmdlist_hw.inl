@@ -31,6 +31,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memadvise_flags.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 #include "shared/source/program/sync_buffer_handler.h"
@@ -108,6 +109,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     removeMemoryPrefetchAllocations();
     commandContainer.reset();
     clearCommandsToPatch();
+    invalidateResidencySet();
+    updateStateTrackingId();
 
     if (!isCopyOnly()) {
         printfKernelContainer.clear();
@@ -330,6 +333,8 @@ inline ze_result_t CommandListCoreFamily<gfxCoreFamily>::executeCommandListImmed
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::close() {
     commandContainer.removeDuplicatesFromResidencyContainer();
+    invalidateResidencySet();
+    updateStateTrackingId();
     if (this->dispatchCmdListBatchBufferAsPrimary) {
         commandContainer.endAlignedPrimaryBuffer();
     } else {
@@ -381,6 +386,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
     auto res = appendLaunchKernelWithParams(Kernel::fromHandle(kernelHandle), threadGroupDimensions,
                                             event, launchParams);
 
+    if (res == ZE_RESULT_SUCCESS && NEO::PrefetchManager::isPredictivePrefetchEnabled()) {
+        appendPredictiveMemoryPrefetch(Kernel::fromHandle(kernelHandle));
+    }
+
     if (!launchParams.skipInOrderNonWalkerSignaling) {
         handleInOrderDependencyCounter(event, isInOrderNonWalkerSignalingRequired(event));
     }
@@ -1309,6 +1318,13 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                                                       NEO::GraphicsAllocation *srcAllocation,
                                                                       size_t size, bool flushHost) {
+    return CommandListCoreFamily<gfxCoreFamily>::appendPageFaultRangeCopy(dstAllocation, srcAllocation, 0u, size, flushHost);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultRangeCopy(NEO::GraphicsAllocation *dstAllocation,
+                                                                           NEO::GraphicsAllocation *srcAllocation,
+                                                                           size_t offset, size_t size, bool flushHost) {
 
     size_t middleElSize = sizeof(uint32_t) * 4;
     uintptr_t rightSize = size % middleElSize;
@@ -1322,17 +1338,17 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
     uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
     ze_result_t ret = ZE_RESULT_ERROR_UNKNOWN;
     if (isCopyOnly()) {
-        return appendMemoryCopyBlit(dstAddress, dstAllocation, 0u,
-                                    srcAddress, srcAllocation, 0u,
+        return appendMemoryCopyBlit(dstAddress, dstAllocation, offset,
+                                    srcAddress, srcAllocation, offset,
                                     size);
     } else {
         CmdListKernelLaunchParams launchParams = {};
         launchParams.isKernelSplitOperation = rightSize > 0;
         launchParams.numKernelsInSplitLaunch = 2;
         ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAddress),
-                                           dstAllocation, 0,
+                                           dstAllocation, offset,
                                            reinterpret_cast<void *>(&srcAddress),
-                                           srcAllocation, 0,
+                                           srcAllocation, offset,
                                            size - rightSize,
                                            middleElSize,
                                            Builtin::copyBufferToBufferMiddle,
@@ -1342,9 +1358,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
         launchParams.numKernelsExecutedInSplitLaunch++;
         if (ret == ZE_RESULT_SUCCESS && rightSize) {
             ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAddress),
-                                               dstAllocation, size - rightSize,
+                                               dstAllocation, offset + size - rightSize,
                                                reinterpret_cast<void *>(&srcAddress),
-                                               srcAllocation, size - rightSize,
+                                               srcAllocation, offset + size - rightSize,
                                                rightSize, 1UL,
                                                Builtin::copyBufferToBufferSide,
                                                nullptr,
@@ -1808,6 +1824,18 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryPrefetch(const voi
     return ZE_RESULT_ERROR_INVALID_ARGUMENT;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::appendPredictiveMemoryPrefetch(Kernel *kernel) {
+    auto prefetchManager = device->getDriverHandle()->getMemoryManager()->getPrefetchManager();
+    if (prefetchManager == nullptr) {
+        return;
+    }
+    // shared allocations are migrated to device on submission, before the walker touches them
+    if (prefetchManager->insertKernelAllocations(this->prefetchContext, *device->getDriverHandle()->getSvmAllocsManager(), kernel->getResidencyContainer())) {
+        this->performMemoryPrefetch = true;
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendUnalignedFillKernel(bool isStateless, uint32_t unalignedSize, const AlignedAllocationData &dstAllocation, const void *pattern, Event *signalEvent, const CmdListKernelLaunchParams &launchParams) {
     Kernel *builtinKernel = nullptr;
@@ -23,6 +23,7 @@
 #include "shared/source/helpers/in_order_cmd_helpers.h"
 #include "shared/source/helpers/surface_format_info.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/wait_util.h"
@@ -375,6 +376,9 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
                                                  *this->device->getDriverHandle()->getSvmAllocsManager(),
                                                  *this->device->getNEODevice(),
                                                  *csr);
+        if (NEO::PrefetchManager::isPredictivePrefetchEnabled()) {
+            this->removeMemoryPrefetchAllocations();
+        }
     }
 
     NEO::CompletionStamp completionStamp;
@@ -396,6 +400,13 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
     this->cmdQImmediate->setTaskCount(completionStamp.taskCount);
 
     if (this->isSyncModeQueue) {
+        if (NEO::debugManager.flags.ReleaseCsrOwnershipBeforeImmediateSynchronize.get() == 1) {
+            // submission is complete, waiting for it does not require CSR state and other command lists can submit to the same engine meanwhile
+            if (lockForIndirect.owns_lock()) {
+                lockForIndirect.unlock();
+            }
+            lockCSR.unlock();
+        }
         status = hostSynchronize(std::numeric_limits<uint64_t>::max(), completionStamp.taskCount, true);
     }
 
@@ -689,6 +700,13 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                                                                NEO::GraphicsAllocation *srcAllocation,
                                                                                size_t size, bool flushHost) {
+    return appendPageFaultRangeCopy(dstAllocation, srcAllocation, 0u, size, flushHost);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultRangeCopy(NEO::GraphicsAllocation *dstAllocation,
+                                                                                    NEO::GraphicsAllocation *srcAllocation,
+                                                                                    size_t offset, size_t size, bool flushHost) {
 
     checkAvailableSpace(0, false, commonImmediateCommandSize);
 
@@ -701,8 +719,8 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
 
     if (isSplitNeeded) {
         relaxedOrdering = isRelaxedOrderingDispatchAllowed(1); // split generates more than 1 event
-        uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress());
-        uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
+        uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress() + offset);
+        uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress() + offset);
         ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uintptr_t, uintptr_t>(this, dstAddress, srcAddress, size, nullptr, 0u, nullptr, false, relaxedOrdering, direction, [&](uintptr_t dstAddressParam, uintptr_t srcAddressParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             this->appendMemoryCopyBlit(dstAddressParam, dstAllocation, 0u,
                                        srcAddressParam, srcAllocation, 0u,
@@ -710,7 +728,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
             return CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEventParam);
         });
     } else {
-        ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstAllocation, srcAllocation, size, flushHost);
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultRangeCopy(dstAllocation, srcAllocation, offset, size, flushHost);
     }
     return flushImmediate(ret, false, false, relaxedOrdering, true, nullptr);
 }
@@ -34,6 +34,7 @@
 namespace L0 {
 
 CommandList::CommandList(uint32_t numIddsPerBlock) : commandContainer(numIddsPerBlock) {
+    updateStateTrackingId();
     if (NEO::debugManager.flags.SplitBcsSize.get() != -1) {
         this->minimalSizeForBcsSplit = NEO::debugManager.flags.SplitBcsSize.get() * MemoryConstants::kiloByte;
     }
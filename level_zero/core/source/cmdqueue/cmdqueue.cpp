@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 
+#include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
@@ -35,6 +36,7 @@
 namespace L0 {
 
 CommandQueueAllocatorFn commandQueueFactory[IGFX_MAX_PRODUCT] = {};
+std::atomic<uint64_t> CommandQueueImp::residencySetMergeIdCounter{0};
 
 bool CommandQueue::frontEndTrackingEnabled() const {
     return NEO::debugManager.flags.AllowPatchingVfeStateInCommandLists.get() || this->frontEndStateTracking;
@@ -356,4 +358,28 @@ void CommandQueueImp::makeResidentAndMigrate(bool performMigration, const NEO::R
     }
 }
 
+uint64_t CommandQueueImp::getNextResidencySetMergeId() {
+    return ++residencySetMergeIdCounter;
+}
+
+void CommandQueueImp::makeCommandListResidentAndMigrate(bool performMigration, CommandList &commandList) {
+    auto &residencySet = commandList.getResidencySet();
+    if (residencySet.lastMergeId == this->residencySetMergeId) {
+        // same command list passed more than once in a single submission
+        return;
+    }
+    residencySet.lastMergeId = this->residencySetMergeId;
+
+    for (auto alloc : commandList.getCmdContainer().getResidencyContainer()) {
+        alloc->prepareHostPtrForResidency(csr);
+        csr->makeResident(*alloc);
+    }
+    if (performMigration && !residencySet.migratableAllocations.empty()) {
+        auto pageFaultManager = device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
+        for (auto alloc : residencySet.migratableAllocations) {
+            pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
+        }
+    }
+}
+
 } // namespace L0
@@ -109,6 +109,19 @@ struct CommandQueueHw : public CommandQueueImp {
         bool globalInit = false;
     };
 
+    // Result of state tracking for the command lists of the last submission.
+    // When the same command lists are executed again and nothing was submitted to the CSR in between,
+    // state tracking ends in the same state, so per command list estimation can be skipped.
+    struct SubmissionStateCache {
+        std::vector<uint64_t> commandListIds;
+        size_t commandListsEstimate = 0;
+        size_t spaceForResidency = 0;
+        TaskCountType taskCount = 0;
+        NEO::PreemptionMode entryPreemption{};
+        NEO::PreemptionMode finalPreemption{};
+        uint32_t steadyExecutions = 0;
+    };
+
     ze_result_t executeCommandListsRegular(CommandListExecutionContext &ctx,
                                            uint32_t numCommandLists,
                                            ze_command_list_handle_t *commandListHandles,
@@ -135,6 +148,16 @@ struct CommandQueueHw : public CommandQueueImp {
     inline size_t estimateLinearStreamSizeComplementary(CommandListExecutionContext &ctx,
                                                         ze_command_list_handle_t *phCommandLists,
                                                         uint32_t numCommandLists);
+    inline bool isSubmissionStateCacheHit(const CommandListExecutionContext &ctx,
+                                          ze_command_list_handle_t *phCommandLists,
+                                          uint32_t numCommandLists) const;
+    inline void updateSubmissionStateCache(bool steadyState,
+                                           NEO::PreemptionMode entryPreemption,
+                                           const CommandListExecutionContext &ctx,
+                                           ze_command_list_handle_t *phCommandLists,
+                                           uint32_t numCommandLists,
+                                           size_t commandListsEstimate,
+                                           size_t spaceForResidency);
     MOCKABLE_VIRTUAL ze_result_t makeAlignedChildStreamAndSetGpuBase(NEO::LinearStream &child, size_t requiredSize);
     inline void getGlobalFenceAndMakeItResident();
     inline void getWorkPartitionAndMakeItResident();
@@ -228,6 +251,7 @@ struct CommandQueueHw : public CommandQueueImp {
                                                               CommandListRequiredStateChange &cmdListRequired);
     inline void updateBaseAddressState(CommandList *lastCommandList);
 
+    SubmissionStateCache submissionStateCache;
     size_t alignedChildStreamPadding{};
 };
 
@@ -236,6 +236,11 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
     }
 
     auto submitResult = this->prepareAndSubmitBatchBuffer(ctx, child);
+    if (submitResult == NEO::SubmissionStatus::success) {
+        this->submissionStateCache.taskCount = this->csr->peekTaskCount();
+    } else {
+        this->submissionStateCache.steadyExecutions = 0;
+    }
 
     this->csr->setPreemptionMode(ctx.statePreemption);
     this->updateTaskCountAndPostSync(ctx.isDispatchTaskCountPostSyncRequired);
@@ -543,6 +548,8 @@ void CommandQueueHw<gfxCoreFamily>::setupCmdListsAndContextParams(
     ze_fence_handle_t hFence) {
 
     ctx.containsAnyRegularCmdList = !ctx.firstCommandList->isImmediateType();
+    const bool residencySetCacheEnabled = CommandList::isResidencySetCacheEnabled();
+    this->residencySetMergeId = getNextResidencySetMergeId();
 
     for (auto i = 0u; i < numCommandLists; i++) {
         auto commandList = static_cast<CommandListImp *>(CommandList::fromHandle(phCommandLists[i]));
@@ -593,7 +600,11 @@ void CommandQueueHw<gfxCoreFamily>::setupCmdListsAndContextParams(
             this->partitionCount = std::max(this->partitionCount, commandList->getPartitionCount());
         }
 
-        makeResidentAndMigrate(ctx.isMigrationRequested, commandContainer.getResidencyContainer());
+        if (residencySetCacheEnabled) {
+            makeCommandListResidentAndMigrate(ctx.isMigrationRequested, *commandList);
+        } else {
+            makeResidentAndMigrate(ctx.isMigrationRequested, commandContainer.getResidencyContainer());
+        }
     }
 
     ctx.isDispatchTaskCountPostSyncRequired = isDispatchTaskCountPostSyncRequired(hFence, ctx.containsAnyRegularCmdList);
@@ -706,39 +717,53 @@ size_t CommandQueueHw<gfxCoreFamily>::estimateLinearStreamSizeComplementary(
     ctx.globalInit |= !gpgpuEnabled;
     ctx.globalInit |= scmStateDirty;
 
-    CommandListRequiredStateChange cmdListState;
-
-    for (uint32_t i = 0; i < numCommandLists; i++) {
-        auto cmdList = CommandList::fromHandle(phCommandLists[i]);
-        auto &requiredStreamState = cmdList->getRequiredStreamState();
-        auto &finalStreamState = cmdList->getFinalStreamState();
-
-        linearStreamSizeEstimate += estimateFrontEndCmdSizeForMultipleCommandLists(frontEndStateDirty, ctx.engineInstanced, cmdList,
-                                                                                   streamProperties, requiredStreamState, finalStreamState,
-                                                                                   cmdListState.requiredState,
-                                                                                   cmdListState.flags.propertyFeDirty, cmdListState.flags.frontEndReturnPoint);
-        linearStreamSizeEstimate += estimatePipelineSelectCmdSizeForMultipleCommandLists(streamProperties, requiredStreamState, finalStreamState, gpgpuEnabled,
-                                                                                         cmdListState.requiredState, cmdListState.flags.propertyPsDirty);
-        linearStreamSizeEstimate += estimateScmCmdSizeForMultipleCommandLists(streamProperties, scmStateDirty, requiredStreamState, finalStreamState,
-                                                                              cmdListState.requiredState, cmdListState.flags.propertyScmDirty);
-        linearStreamSizeEstimate += estimateStateBaseAddressCmdSizeForMultipleCommandLists(baseAdresStateDirty, cmdList->getCmdListHeapAddressModel(), streamProperties, requiredStreamState, finalStreamState,
-                                                                                           cmdListState.requiredState, cmdListState.flags.propertySbaDirty);
-        linearStreamSizeEstimate += computePreemptionSizeForCommandList(ctx, cmdList, cmdListState.flags.preemptionDirty);
-
-        linearStreamSizeEstimate += estimateCommandListSecondaryStart(cmdList);
-        ctx.spaceForResidency += estimateCommandListResidencySize(cmdList);
-
-        if (cmdListState.flags.isAnyDirty()) {
-            cmdListState.commandList = cmdList;
-            cmdListState.cmdListIndex = i;
-            cmdListState.newPreemptionMode = ctx.statePreemption;
-            this->stateChanges.push_back(cmdListState);
-
-            linearStreamSizeEstimate += this->estimateCommandListPrimaryStart(true);
-
-            cmdListState.requiredState.resetState();
-            cmdListState.flags.cleanDirty();
+    const bool entryStateClean = !frontEndStateDirty && gpgpuEnabled && !baseAdresStateDirty && !scmStateDirty;
+    if (entryStateClean && isSubmissionStateCacheHit(ctx, phCommandLists, numCommandLists)) {
+        linearStreamSizeEstimate += this->submissionStateCache.commandListsEstimate;
+        ctx.spaceForResidency += this->submissionStateCache.spaceForResidency;
+        ctx.statePreemption = this->submissionStateCache.finalPreemption;
+    } else {
+        const auto entryPreemption = ctx.statePreemption;
+        const auto entrySpaceForResidency = ctx.spaceForResidency;
+        const auto entryEstimate = linearStreamSizeEstimate;
+
+        CommandListRequiredStateChange cmdListState;
+
+        for (uint32_t i = 0; i < numCommandLists; i++) {
+            auto cmdList = CommandList::fromHandle(phCommandLists[i]);
+            auto &requiredStreamState = cmdList->getRequiredStreamState();
+            auto &finalStreamState = cmdList->getFinalStreamState();
+
+            linearStreamSizeEstimate += estimateFrontEndCmdSizeForMultipleCommandLists(frontEndStateDirty, ctx.engineInstanced, cmdList,
+                                                                                       streamProperties, requiredStreamState, finalStreamState,
+                                                                                       cmdListState.requiredState,
+                                                                                       cmdListState.flags.propertyFeDirty, cmdListState.flags.frontEndReturnPoint);
+            linearStreamSizeEstimate += estimatePipelineSelectCmdSizeForMultipleCommandLists(streamProperties, requiredStreamState, finalStreamState, gpgpuEnabled,
+                                                                                             cmdListState.requiredState, cmdListState.flags.propertyPsDirty);
+            linearStreamSizeEstimate += estimateScmCmdSizeForMultipleCommandLists(streamProperties, scmStateDirty, requiredStreamState, finalStreamState,
+                                                                                  cmdListState.requiredState, cmdListState.flags.propertyScmDirty);
+            linearStreamSizeEstimate += estimateStateBaseAddressCmdSizeForMultipleCommandLists(baseAdresStateDirty, cmdList->getCmdListHeapAddressModel(), streamProperties, requiredStreamState, finalStreamState,
+                                                                                               cmdListState.requiredState, cmdListState.flags.propertySbaDirty);
+            linearStreamSizeEstimate += computePreemptionSizeForCommandList(ctx, cmdList, cmdListState.flags.preemptionDirty);
+
+            linearStreamSizeEstimate += estimateCommandListSecondaryStart(cmdList);
+            ctx.spaceForResidency += estimateCommandListResidencySize(cmdList);
+
+            if (cmdListState.flags.isAnyDirty()) {
+                cmdListState.commandList = cmdList;
+                cmdListState.cmdListIndex = i;
+                cmdListState.newPreemptionMode = ctx.statePreemption;
+                this->stateChanges.push_back(cmdListState);
+
+                linearStreamSizeEstimate += this->estimateCommandListPrimaryStart(true);
+
+                cmdListState.requiredState.resetState();
+                cmdListState.flags.cleanDirty();
+            }
         }
+
+        updateSubmissionStateCache(entryStateClean && this->stateChanges.empty(), entryPreemption, ctx, phCommandLists, numCommandLists,
+                                   linearStreamSizeEstimate - entryEstimate, ctx.spaceForResidency - entrySpaceForResidency);
     }
 
     if (ctx.gsbaStateDirty && !this->stateBaseAddressTracking) {
@@ -768,6 +793,68 @@ size_t CommandQueueHw<gfxCoreFamily>::estimateLinearStreamSizeComplementary(
     return linearStreamSizeEstimate;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandQueueHw<gfxCoreFamily>::isSubmissionStateCacheHit(const CommandListExecutionContext &ctx,
+                                                              ze_command_list_handle_t *phCommandLists,
+                                                              uint32_t numCommandLists) const {
+    auto &cache = this->submissionStateCache;
+    if (cache.steadyExecutions < 2 ||
+        cache.taskCount != this->csr->peekTaskCount() ||
+        cache.entryPreemption != ctx.statePreemption ||
+        cache.commandListIds.size() != numCommandLists) {
+        return false;
+    }
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        if (cache.commandListIds[i] != CommandList::fromHandle(phCommandLists[i])->getStateTrackingId()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::updateSubmissionStateCache(bool steadyState,
+                                                               NEO::PreemptionMode entryPreemption,
+                                                               const CommandListExecutionContext &ctx,
+                                                               ze_command_list_handle_t *phCommandLists,
+                                                               uint32_t numCommandLists,
+                                                               size_t commandListsEstimate,
+                                                               size_t spaceForResidency) {
+    if (NEO::debugManager.flags.EnableSubmissionStateCache.get() != 1) {
+        return;
+    }
+    auto &cache = this->submissionStateCache;
+    if (!steadyState) {
+        cache.steadyExecutions = 0;
+        return;
+    }
+
+    bool sameCommandLists = cache.steadyExecutions > 0 &&
+                            cache.taskCount == this->csr->peekTaskCount() &&
+                            cache.entryPreemption == entryPreemption &&
+                            cache.finalPreemption == ctx.statePreemption &&
+                            cache.commandListIds.size() == numCommandLists;
+    for (uint32_t i = 0; sameCommandLists && i < numCommandLists; i++) {
+        sameCommandLists = cache.commandListIds[i] == CommandList::fromHandle(phCommandLists[i])->getStateTrackingId();
+    }
+
+    if (sameCommandLists) {
+        // state at the end of this submission matches the state at its beginning, it can be reused
+        cache.steadyExecutions++;
+        return;
+    }
+
+    cache.commandListIds.resize(numCommandLists);
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        cache.commandListIds[i] = CommandList::fromHandle(phCommandLists[i])->getStateTrackingId();
+    }
+    cache.commandListsEstimate = commandListsEstimate;
+    cache.spaceForResidency = spaceForResidency;
+    cache.entryPreemption = entryPreemption;
+    cache.finalPreemption = ctx.statePreemption;
+    cache.steadyExecutions = 1;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandQueueHw<gfxCoreFamily>::makeAlignedChildStreamAndSetGpuBase(NEO::LinearStream &child, size_t requiredSize) {
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -95,6 +95,8 @@ struct CommandQueueImp : public CommandQueue {
     virtual bool getPreemptionCmdProgramming() = 0;
     void handleIndirectAllocationResidency(UnifiedMemoryControls unifiedMemoryControls, std::unique_lock<std::mutex> &lockForIndirect, bool performMigration) override;
     void makeResidentAndMigrate(bool performMigration, const NEO::ResidencyContainer &residencyContainer) override;
+    void makeCommandListResidentAndMigrate(bool performMigration, CommandList &commandList);
+    static uint64_t getNextResidencySetMergeId();
     void printKernelsPrintfOutput(bool hangDetected);
     void checkAssert();
     void unregisterCsrClient() override;
@@ -152,6 +154,9 @@ struct CommandQueueImp : public CommandQueue {
     NEO::CommandStreamReceiver *csr = nullptr;
     NEO::LinearStream *startingCmdBuffer = nullptr;
 
+    // ids of submissions are unique in process, so command list merged by a destroyed queue is never taken as merged
+    static std::atomic<uint64_t> residencySetMergeIdCounter;
+    uint64_t residencySetMergeId = 0;
     uint32_t currentStateChangeIndex = 0;
 
     std::atomic<bool> cmdListWithAssertExecuted = false;
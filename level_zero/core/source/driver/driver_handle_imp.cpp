@@ -27,6 +27,7 @@
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_imp.h"
 #include "level_zero/core/source/driver/host_pointer_manager.h"
+#include "level_zero/core/source/event/event_completion_monitor.h"
 #include "level_zero/core/source/fabric/fabric.h"
 #include "level_zero/core/source/image/image.h"
 
@@ -103,6 +104,16 @@ NEO::SVMAllocsManager *DriverHandleImp::getSvmAllocsManager() {
     return this->svmAllocsManager;
 }
 
+EventCompletionMonitor *DriverHandleImp::getEventCompletionMonitor() {
+    if (!EventCompletionMonitor::isEnabled()) {
+        return nullptr;
+    }
+    std::call_once(eventCompletionMonitorInitFlag, [this]() {
+        this->eventCompletionMonitor = std::make_unique<EventCompletionMonitor>();
+    });
+    return this->eventCompletionMonitor.get();
+}
+
 ze_result_t DriverHandleImp::getApiVersion(ze_api_version_t *version) {
     *version = ZE_API_VERSION_1_3;
     return ZE_RESULT_SUCCESS;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,7 @@
 #include <mutex>
 
 namespace L0 {
+class EventCompletionMonitor;
 class HostPointerManager;
 struct FabricVertex;
 struct FabricEdge;
@@ -72,6 +73,7 @@ struct DriverHandleImp : public DriverHandle {
     MOCKABLE_VIRTUAL void *importNTHandle(ze_device_handle_t hDevice, void *handle, NEO::AllocationType allocationType);
     ze_result_t checkMemoryAccessFromDevice(Device *device, const void *ptr) override;
     NEO::SVMAllocsManager *getSvmAllocsManager() override;
+    EventCompletionMonitor *getEventCompletionMonitor();
     ze_result_t initialize(std::vector<std::unique_ptr<NEO::Device>> neoDevices);
     bool findAllocationDataForRange(const void *buffer,
                                     size_t size,
@@ -126,6 +128,8 @@ struct DriverHandleImp : public DriverHandle {
     [[nodiscard]] std::unique_lock<std::mutex> lockIPCHandleMap() { return std::unique_lock<std::mutex>(this->ipcHandleMapMutex); };
 
     std::unique_ptr<HostPointerManager> hostPointerManager;
+    std::unique_ptr<EventCompletionMonitor> eventCompletionMonitor;
+    std::once_flag eventCompletionMonitorInitFlag;
     // Experimental functions
     std::unordered_map<std::string, void *> extensionFunctionsLookupMap;
 
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_completion_monitor.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include "level_zero/core/source/event/event.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace L0 {
+
+EventCompletionMonitor::EventCompletionMonitor() {
+    if (NEO::debugManager.flags.EventCompletionMonitorPollPeriod.get() != -1) {
+        pollPeriod = std::chrono::microseconds{NEO::debugManager.flags.EventCompletionMonitorPollPeriod.get()};
+    }
+
+    monitorThread = NEO::Thread::create(monitorEvents, reinterpret_cast<void *>(this));
+}
+
+EventCompletionMonitor::~EventCompletionMonitor() {
+    {
+        std::lock_guard<std::mutex> lock(waitersMutex);
+        keepMonitoring.store(false);
+    }
+    waitersAdded.notify_one();
+    if (monitorThread) {
+        monitorThread->join();
+        monitorThread.reset();
+    }
+}
+
+bool EventCompletionMonitor::isEnabled() {
+    return NEO::debugManager.flags.EnableEventCompletionMonitor.get() == 1;
+}
+
+ze_result_t EventCompletionMonitor::waitForCompletion(Event &event, std::chrono::nanoseconds maxWaitTime) {
+    if (event.queryStatus() == ZE_RESULT_SUCCESS) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    Waiter waiter{&event};
+    std::unique_lock<std::mutex> lock(waitersMutex);
+    waiters.push_back(&waiter);
+    waitersAdded.notify_one();
+
+    waitersSignaled.wait_for(lock, maxWaitTime, [&waiter]() { return waiter.signaled; });
+    if (waiter.signaled) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    waiters.erase(std::find(waiters.begin(), waiters.end(), &waiter));
+    return ZE_RESULT_NOT_READY;
+}
+
+void *EventCompletionMonitor::monitorEvents(void *self) {
+    auto monitor = reinterpret_cast<EventCompletionMonitor *>(self);
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(monitor->waitersMutex);
+            monitor->waitersAdded.wait(lock, [monitor]() { return !monitor->keepMonitoring.load() || !monitor->waiters.empty(); });
+            if (!monitor->keepMonitoring.load()) {
+                return nullptr;
+            }
+        }
+
+        monitor->checkWaiters();
+        monitor->sleep();
+    }
+}
+
+void EventCompletionMonitor::checkWaiters() {
+    bool anySignaled = false;
+    {
+        std::lock_guard<std::mutex> lock(waitersMutex);
+        for (auto it = waiters.begin(); it != waiters.end();) {
+            if ((*it)->event->queryStatus() == ZE_RESULT_SUCCESS) {
+                (*it)->signaled = true;
+                anySignaled = true;
+                it = waiters.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    if (anySignaled) {
+        waitersSignaled.notify_all();
+    }
+}
+
+void EventCompletionMonitor::sleep() {
+    std::this_thread::sleep_for(pollPeriod);
+}
+
+} // namespace L0
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <level_zero/ze_api.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace L0 {
+struct Event;
+
+// Single driver thread polling completion of all events waited on by host threads.
+// Waiters sleep on a condition variable (futex based on Linux) instead of polling their own events,
+// wake up latency is bounded by the polling period of the monitor thread.
+class EventCompletionMonitor {
+  public:
+    static constexpr int64_t defaultPollPeriod = 50;
+
+    EventCompletionMonitor();
+    virtual ~EventCompletionMonitor();
+
+    static bool isEnabled();
+
+    ze_result_t waitForCompletion(Event &event, std::chrono::nanoseconds maxWaitTime);
+
+  protected:
+    struct Waiter {
+        Event *event = nullptr;
+        bool signaled = false;
+    };
+
+    static void *monitorEvents(void *self);
+    void checkWaiters();
+    MOCKABLE_VIRTUAL void sleep();
+
+    std::vector<Waiter *> waiters;
+    std::mutex waitersMutex;
+    std::condition_variable waitersAdded;
+    std::condition_variable waitersSignaled;
+
+    std::unique_ptr<NEO::Thread> monitorThread;
+    std::atomic_bool keepMonitoring = true;
+    std::chrono::microseconds pollPeriod{defaultPollPeriod};
+};
+
+} // namespace L0
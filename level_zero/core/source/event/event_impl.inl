@@ -18,6 +18,8 @@
 #include "shared/source/utilities/wait_util.h"
 
 #include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/core/source/event/event_completion_monitor.h"
 #include "level_zero/core/source/event/event_imp.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/kernel/kernel.h"
@@ -525,11 +527,22 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
         timeout = NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get();
     }
 
+    EventCompletionMonitor *completionMonitor = nullptr;
+    if (timeout != 0 && !(isKmdWaitModeEnabled() && isCounterBased())) {
+        completionMonitor = static_cast<DriverHandleImp *>(this->device->getDriverHandle())->getEventCompletionMonitor();
+    }
+
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
     do {
         if (isKmdWaitModeEnabled() && isCounterBased()) {
             ret = waitForUserFence(timeout);
+        } else if (completionMonitor) {
+            auto maxWaitTime = std::chrono::duration_cast<std::chrono::nanoseconds>(this->gpuHangCheckPeriod);
+            if (timeout != std::numeric_limits<uint64_t>::max() && timeout - timeDiff < static_cast<uint64_t>(maxWaitTime.count())) {
+                maxWaitTime = std::chrono::nanoseconds(static_cast<int64_t>(timeout - timeDiff));
+            }
+            ret = completionMonitor->waitForCompletion(*this, maxWaitTime);
         } else {
             ret = queryStatus();
         }
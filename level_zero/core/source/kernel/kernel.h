@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,16 @@ struct KernelImmutableData {
 
     const NEO::KernelInfo *getKernelInfo() const { return kernelInfo; }
 
+    // binds descriptor only, remaining state is created by initialize (lazy kernel initialization)
+    void setKernelInfo(NEO::KernelInfo *kernelInfo) {
+        this->kernelInfo = kernelInfo;
+        this->kernelDescriptor = &kernelInfo->kernelDescriptor;
+    }
+
+    bool isInitialized() const {
+        return initialized;
+    }
+
     void setIsaCopiedToAllocation() {
         isaCopiedToAllocation = true;
     }
@@ -104,6 +114,7 @@ struct KernelImmutableData {
     std::vector<NEO::GraphicsAllocation *> residencyContainer;
 
     bool isaCopiedToAllocation = false;
+    bool initialized = false;
 };
 
 struct Kernel : _ze_kernel_handle_t, virtual NEO::DispatchKernelEncoderI {
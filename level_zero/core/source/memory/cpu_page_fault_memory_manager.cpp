@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,32 @@ void PageFaultManager::transferToGpu(void *ptr, void *device) {
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
 }
+void PageFaultManager::transferRangeToCpu(void *ptr, size_t offset, size_t size, void *device) {
+    L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
+
+    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    auto ret =
+        deviceImp->pageFaultCommandList->appendPageFaultRangeCopy(allocData->cpuAllocation,
+                                                                  allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
+                                                                  offset, size, true);
+    UNRECOVERABLE_IF(ret);
+}
+void PageFaultManager::transferRangeToGpu(void *ptr, size_t offset, size_t size, void *device) {
+    L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
+
+    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    auto ret =
+        deviceImp->pageFaultCommandList->appendPageFaultRangeCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
+                                                                  allocData->cpuAllocation,
+                                                                  offset, size, false);
+    UNRECOVERABLE_IF(ret);
+
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(pageFaultData.cmdQ);
 
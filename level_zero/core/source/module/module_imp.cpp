@@ -39,6 +39,7 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/program/isa_pool_allocator.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_initialization.h"
 
@@ -520,6 +521,17 @@ ModuleImp::~ModuleImp() {
         DEBUG_BREAK_IF(this->device->getNEODevice()->getMemoryManager() == nullptr);
         this->device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(this->kernelsIsaParentRegion.release());
     }
+    if (this->sharedIsaAllocation) {
+        this->device->getNEODevice()->getIsaPoolAllocator().freeSharedIsaAllocation(this->sharedIsaAllocation);
+        this->sharedIsaAllocation = nullptr;
+    }
+}
+
+NEO::GraphicsAllocation *ModuleImp::getKernelsIsaParentAllocation() const {
+    if (this->sharedIsaAllocation) {
+        return this->sharedIsaAllocation->getGraphicsAllocation();
+    }
+    return this->kernelsIsaParentRegion.get();
 }
 
 NEO::Zebin::Debug::Segments ModuleImp::getZebinSegments() {
@@ -542,6 +554,7 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
     if (this->shouldBuildBeFailed(neoDevice)) {
         return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
     }
+    this->lazyKernelInitialization = this->isLazyKernelInitializationAllowed();
     if (result = this->initializeKernelImmutableDatas(); result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -566,7 +579,7 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
     linkageSuccessful &= populateHostGlobalSymbolsMap(this->translationUnit->programInfo.globalsDeviceToHostNameMap);
     this->updateBuildLog(neoDevice);
 
-    if ((this->isFullyLinked && this->type == ModuleType::user) || (this->kernelsIsaParentRegion && this->type == ModuleType::builtin)) {
+    if ((this->isFullyLinked && this->type == ModuleType::user) || (this->getKernelsIsaParentAllocation() && this->type == ModuleType::builtin)) {
         this->transferIsaSegmentsToAllocation(neoDevice, nullptr);
 
         if (device->getL0Debugger()) {
@@ -585,12 +598,13 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
     const auto &productHelper = neoDevice->getProductHelper();
     auto &rootDeviceEnvironment = neoDevice->getRootDeviceEnvironment();
 
-    if (this->kernelsIsaParentRegion && this->kernelImmDatas.size()) {
+    if (auto isaParentAllocation = this->getKernelsIsaParentAllocation(); isaParentAllocation && this->kernelImmDatas.size()) {
         if (this->kernelImmDatas[0]->isIsaCopiedToAllocation()) {
             return;
         }
 
-        const auto isaBufferSize = this->kernelsIsaParentRegion->getUnderlyingBufferSize();
+        const auto isaBaseOffset = this->sharedIsaAllocation ? this->sharedIsaAllocation->getOffset() : 0u;
+        const auto isaBufferSize = this->sharedIsaAllocation ? this->sharedIsaAllocation->getSize() : isaParentAllocation->getUnderlyingBufferSize();
         DEBUG_BREAK_IF(isaBufferSize == 0);
         auto isaBuffer = std::vector<std::byte>(isaBufferSize);
         std::memset(isaBuffer.data(), 0x0, isaBufferSize);
@@ -601,38 +615,60 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
             kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
 
             auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
-            auto offset = kernelImmData->getIsaOffsetInParentAllocation();
+            auto offset = kernelImmData->getIsaOffsetInParentAllocation() - isaBaseOffset;
             memcpy_s(isaBuffer.data() + offset, isaBufferSize - offset, kernelHeapPtr, kernelHeapSize);
         }
-        NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *this->kernelsIsaParentRegion),
-                                                              *neoDevice,
-                                                              this->kernelsIsaParentRegion.get(),
-                                                              0u,
-                                                              isaBuffer.data(),
-                                                              isaBuffer.size());
+        {
+            std::unique_lock<std::mutex> sharedAllocationLock;
+            if (this->sharedIsaAllocation) {
+                sharedAllocationLock = this->sharedIsaAllocation->obtainSharedAllocationLock();
+            }
+            NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *isaParentAllocation),
+                                                                  *neoDevice,
+                                                                  isaParentAllocation,
+                                                                  isaBaseOffset,
+                                                                  isaBuffer.data(),
+                                                                  isaBuffer.size());
+        }
         for (auto &kernelImmData : kernelImmDatas) {
             kernelImmData->setIsaCopiedToAllocation();
         }
+        if (this->sharedIsaAllocation && this->isaDeduplicationAllowed) {
+            neoDevice->getIsaPoolAllocator().registerDeduplicatedIsa(this->isaContentHash, this->isaContent, this->sharedIsaAllocation);
+            this->isaContent.clear();
+            this->isaContent.shrink_to_fit();
+        }
     } else {
         for (auto &kernelImmData : kernelImmDatas) {
-            if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaCopiedToAllocation()) {
+            if (this->isIsaUploadDeferred(*kernelImmData)) {
                 continue;
             }
-            kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
-            kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
-
-            auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
-            NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation()),
-                                                                  *neoDevice,
-                                                                  kernelImmData->getIsaGraphicsAllocation(),
-                                                                  0u,
-                                                                  kernelHeapPtr,
-                                                                  kernelHeapSize);
-            kernelImmData->setIsaCopiedToAllocation();
+            this->transferKernelIsaToAllocation(neoDevice, kernelImmData, isaSegmentsForPatching);
         }
     }
 }
 
+void ModuleImp::transferKernelIsaToAllocation(NEO::Device *neoDevice, const std::unique_ptr<KernelImmutableData> &kernelImmData,
+                                              const NEO::Linker::PatchableSegments *isaSegmentsForPatching) {
+    if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaCopiedToAllocation()) {
+        return;
+    }
+    const auto &productHelper = neoDevice->getProductHelper();
+    auto &rootDeviceEnvironment = neoDevice->getRootDeviceEnvironment();
+
+    kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+    kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+
+    auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
+    NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation()),
+                                                          *neoDevice,
+                                                          kernelImmData->getIsaGraphicsAllocation(),
+                                                          0u,
+                                                          kernelHeapPtr,
+                                                          kernelHeapSize);
+    kernelImmData->setIsaCopiedToAllocation();
+}
+
 std::pair<const void *, size_t> ModuleImp::getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData,
                                                                        const NEO::Linker::PatchableSegments *isaSegmentsForPatching) {
     if (isaSegmentsForPatching) {
@@ -760,6 +796,10 @@ ze_result_t ModuleImp::initializeKernelImmutableDatas() {
             return result;
         }
         for (size_t i = 0lu; i < kernelsCount; i++) {
+            if (this->lazyKernelInitialization) {
+                kernelImmDatas[i]->setKernelInfo(this->translationUnit->programInfo.kernelInfos[i]);
+                continue;
+            }
             result = kernelImmDatas[i]->initialize(this->translationUnit->programInfo.kernelInfos[i],
                                                    device,
                                                    device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
@@ -775,6 +815,52 @@ ze_result_t ModuleImp::initializeKernelImmutableDatas() {
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t ModuleImp::initializeKernelImmutableDataOnFirstUse(const char *kernelName) {
+    if (false == this->lazyKernelInitialization) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> lock(this->lazyKernelInitializationMutex);
+    for (size_t i = 0lu; i < this->kernelImmDatas.size(); i++) {
+        auto &kernelImmData = this->kernelImmDatas[i];
+        if (kernelImmData->getDescriptor().kernelMetadata.kernelName.compare(kernelName) != 0) {
+            continue;
+        }
+        if (kernelImmData->isInitialized()) {
+            return ZE_RESULT_SUCCESS;
+        }
+
+        auto result = kernelImmData->initialize(this->translationUnit->programInfo.kernelInfos[i],
+                                                device,
+                                                device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                                                this->translationUnit->globalConstBuffer,
+                                                this->translationUnit->globalVarBuffer,
+                                                this->type == ModuleType::builtin);
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+        auto patchedSegments = this->isaSegmentsForPatching.empty() ? nullptr : &this->isaSegmentsForPatching;
+        this->transferKernelIsaToAllocation(device->getNEODevice(), kernelImmData, patchedSegments);
+        return ZE_RESULT_SUCCESS;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+bool ModuleImp::isLazyKernelInitializationAllowed() const {
+    if (NEO::debugManager.flags.EnableLazyKernelInitialization.get() != 1) {
+        return false;
+    }
+    // debugger requires all ISA to be loaded when module is reported as created
+    return (this->type == ModuleType::user) && (this->device->getL0Debugger() == nullptr);
+}
+
+bool ModuleImp::isIsaUploadDeferred(const KernelImmutableData &kernelImmData) const {
+    // exported functions may be called by any kernel, so they are always uploaded with the module
+    return this->lazyKernelInitialization &&
+           (false == kernelImmData.isInitialized()) &&
+           (kernelImmData.getIsaGraphicsAllocation() != this->exportedFunctionsSurface);
+}
+
 ze_result_t ModuleImp::allocateKernelImmutableDatas(size_t kernelsCount) {
     if (this->kernelImmDatas.size() == kernelsCount) {
         return ZE_RESULT_SUCCESS;
@@ -803,7 +889,9 @@ ze_result_t ModuleImp::setIsaGraphicsAllocations() {
     }
 
     bool debuggerDisabled = (this->device->getL0Debugger() == nullptr);
-    if (debuggerDisabled && kernelsIsaTotalSize <= isaAllocationPageSize) {
+    if (debuggerDisabled && kernelsIsaTotalSize <= isaAllocationPageSize && NEO::ISAPoolAllocator::isPoolingEnabled()) {
+        return this->setIsaGraphicsAllocationsFromPool(kernelsChunks, kernelsIsaTotalSize);
+    } else if (debuggerDisabled && kernelsIsaTotalSize <= isaAllocationPageSize) {
         if (auto allocation = this->allocateKernelsIsaMemory(kernelsIsaTotalSize); allocation == nullptr) {
             return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
         } else {
@@ -829,6 +917,60 @@ ze_result_t ModuleImp::setIsaGraphicsAllocations() {
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t ModuleImp::setIsaGraphicsAllocationsFromPool(const std::vector<std::pair<size_t, size_t>> &kernelsChunks, size_t kernelsIsaTotalSize) {
+    auto &isaPoolAllocator = this->device->getNEODevice()->getIsaPoolAllocator();
+    const bool isBuiltin = (this->type == ModuleType::builtin);
+
+    this->isaDeduplicationAllowed = this->isIsaDeduplicationAllowed();
+    bool isaDeduplicated = false;
+    if (this->isaDeduplicationAllowed) {
+        // layout and kernel heaps, compared byte by byte on hash hit
+        auto appendToContent = [this](const void *data, size_t size) {
+            auto bytes = reinterpret_cast<const char *>(data);
+            this->isaContent.insert(this->isaContent.end(), bytes, bytes + size);
+        };
+        this->isaContent.clear();
+        appendToContent(&kernelsIsaTotalSize, sizeof(kernelsIsaTotalSize));
+        for (auto i = 0lu; i < kernelsChunks.size(); i++) {
+            const auto &heapInfo = this->translationUnit->programInfo.kernelInfos[i]->heapInfo;
+            appendToContent(&kernelsChunks[i].first, sizeof(kernelsChunks[i].first));
+            appendToContent(heapInfo.pKernelHeap, static_cast<size_t>(heapInfo.kernelHeapSize));
+        }
+        NEO::Hash128 hash;
+        hash.update(this->isaContent.data(), this->isaContent.size());
+        this->isaContentHash = hash.finish();
+        this->sharedIsaAllocation = isaPoolAllocator.acquireDeduplicatedIsa(this->isaContentHash, this->isaContent, isBuiltin);
+        isaDeduplicated = (this->sharedIsaAllocation != nullptr);
+        if (isaDeduplicated) {
+            this->isaContent.clear();
+            this->isaContent.shrink_to_fit();
+        }
+    }
+    if (this->sharedIsaAllocation == nullptr) {
+        this->sharedIsaAllocation = isaPoolAllocator.requestGraphicsAllocationForIsa(isBuiltin, kernelsIsaTotalSize);
+        if (this->sharedIsaAllocation == nullptr) {
+            return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+    }
+
+    for (auto i = 0lu; i < kernelsChunks.size(); i++) {
+        auto [isaOffset, isaSize] = kernelsChunks[i];
+        this->kernelImmDatas[i]->setIsaParentAllocation(this->sharedIsaAllocation->getGraphicsAllocation());
+        this->kernelImmDatas[i]->setIsaSubAllocationOffset(this->sharedIsaAllocation->getOffset() + isaOffset);
+        this->kernelImmDatas[i]->setIsaSubAllocationSize(isaSize);
+        if (isaDeduplicated) {
+            this->kernelImmDatas[i]->setIsaCopiedToAllocation();
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+bool ModuleImp::isIsaDeduplicationAllowed() const {
+    // ISA patched by the linker embeds addresses of module's own allocations, so it cannot be shared
+    auto linkerInput = this->translationUnit->programInfo.linkerInput.get();
+    return (linkerInput == nullptr) || (false == linkerInput->getTraits().requiresPatchingOfInstructionSegments);
+}
+
 size_t ModuleImp::computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize) {
     auto isaPadding = this->device->getGfxCoreHelper().getPaddingForISAAllocation();
     auto kernelStartPointerAlignment = this->device->getGfxCoreHelper().getKernelIsaPointerAlignment();
@@ -954,6 +1096,10 @@ ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
         driverHandle->clearErrorDescription();
         return ZE_RESULT_ERROR_INVALID_MODULE_UNLINKED;
     }
+    if (res = this->initializeKernelImmutableDataOnFirstUse(desc->pKernelName); res != ZE_RESULT_SUCCESS) {
+        driverHandle->clearErrorDescription();
+        return res;
+    }
     auto kernel = Kernel::create(productFamily, this, desc, &res);
 
     if (res == ZE_RESULT_SUCCESS) {
@@ -1161,6 +1307,9 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
     // If the Function Pointer is not in the exported symbol table, then this function might be a kernel.
     // Check if the function name matches a kernel and return the gpu address to that function
     if (*pfnFunction == nullptr) {
+        if (auto result = this->initializeKernelImmutableDataOnFirstUse(pFunctionName); result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
         auto kernelImmData = this->getKernelImmutableData(pFunctionName);
         if (kernelImmData != nullptr) {
             auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
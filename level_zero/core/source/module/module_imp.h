@@ -9,6 +9,7 @@
 
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/linker.h"
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/program/program_info.h"
 
 #include "level_zero/core/source/kernel/kernel.h"
@@ -18,11 +19,13 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
 namespace NEO {
 struct KernelDescriptor;
+class SharedIsaAllocation;
 
 namespace Zebin::Debug {
 struct Segments;
@@ -125,7 +128,7 @@ struct ModuleImp : public Module {
     const KernelImmutableData *getKernelImmutableData(const char *kernelName) const override;
 
     const std::vector<std::unique_ptr<KernelImmutableData>> &getKernelImmutableDataVector() const override { return kernelImmDatas; }
-    NEO::GraphicsAllocation *getKernelsIsaParentAllocation() const { return kernelsIsaParentRegion.get(); }
+    NEO::GraphicsAllocation *getKernelsIsaParentAllocation() const;
 
     uint32_t getMaxGroupSize(const NEO::KernelDescriptor &kernelDescriptor) const override;
 
@@ -165,6 +168,9 @@ struct ModuleImp : public Module {
     bool shouldBuildBeFailed(NEO::Device *neoDevice);
     ze_result_t allocateKernelImmutableDatas(size_t kernelsCount);
     ze_result_t initializeKernelImmutableDatas();
+    ze_result_t initializeKernelImmutableDataOnFirstUse(const char *kernelName);
+    bool isLazyKernelInitializationAllowed() const;
+    bool isIsaUploadDeferred(const KernelImmutableData &kernelImmData) const;
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
     void verifyDebugCapabilities();
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
@@ -175,7 +181,10 @@ struct ModuleImp : public Module {
     void notifyModuleDestroy();
     bool populateHostGlobalSymbolsMap(std::unordered_map<std::string, std::string> &devToHostNameMapping);
     ze_result_t setIsaGraphicsAllocations();
+    ze_result_t setIsaGraphicsAllocationsFromPool(const std::vector<std::pair<size_t, size_t>> &kernelsChunks, size_t kernelsIsaTotalSize);
+    bool isIsaDeduplicationAllowed() const;
     void transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
+    void transferKernelIsaToAllocation(NEO::Device *neoDevice, const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     std::pair<const void *, size_t> getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     MOCKABLE_VIRTUAL size_t computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize);
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation *allocateKernelsIsaMemory(size_t size);
@@ -187,6 +196,9 @@ struct ModuleImp : public Module {
     ModuleBuildLog *moduleBuildLog = nullptr;
     NEO::GraphicsAllocation *exportedFunctionsSurface = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> kernelsIsaParentRegion;
+    NEO::SharedIsaAllocation *sharedIsaAllocation = nullptr;
+    NEO::Hash128Value isaContentHash{};
+    std::vector<char> isaContent;
     std::vector<std::shared_ptr<Kernel>> printfKernelContainer;
     std::vector<std::unique_ptr<KernelImmutableData>> kernelImmDatas;
     NEO::Linker::RelocatedSymbolsMap symbols;
@@ -205,6 +217,8 @@ struct ModuleImp : public Module {
     bool isFunctionSymbolExportEnabled = false;
     bool isGlobalSymbolExportEnabled = false;
     bool precompiled = false;
+    bool lazyKernelInitialization = false;
+    bool isaDeduplicationAllowed = false;
     ModuleType type;
     NEO::Linker::UnresolvedExternals unresolvedExternalsInfo{};
     std::set<NEO::GraphicsAllocation *> importedSymbolAllocations{};
@@ -216,6 +230,7 @@ struct ModuleImp : public Module {
 
     NEO::Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
+    std::mutex lazyKernelInitializationMutex;
 };
 
 bool moveBuildOption(std::string &dstOptionsSet, std::string &srcOptionSet, NEO::ConstStringRef dstOptionName, NEO::ConstStringRef srcOptionName);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -397,6 +397,13 @@ struct MockCommandList : public CommandList {
                       size_t size,
                       bool flushHost));
 
+    ADDMETHOD_NOBASE(appendPageFaultRangeCopy, ze_result_t, ZE_RESULT_SUCCESS,
+                     (NEO::GraphicsAllocation * dstptr,
+                      NEO::GraphicsAllocation *srcptr,
+                      size_t offset,
+                      size_t size,
+                      bool flushHost));
+
     ADDMETHOD_NOBASE(appendMemoryCopyRegion, ze_result_t, ZE_RESULT_SUCCESS,
                      (void *dstptr,
                       const ze_copy_region_t *dstRegion,
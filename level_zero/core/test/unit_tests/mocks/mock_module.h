@@ -58,12 +58,15 @@ struct WhiteBox<::L0::Module> : public ::L0::ModuleImp {
     using BaseClass::device;
     using BaseClass::exportedFunctionsSurface;
     using BaseClass::importedSymbolAllocations;
+    using BaseClass::isaDeduplicationAllowed;
+    using BaseClass::isIsaDeduplicationAllowed;
     using BaseClass::isaSegmentsForPatching;
     using BaseClass::isFullyLinked;
     using BaseClass::isFunctionSymbolExportEnabled;
     using BaseClass::isGlobalSymbolExportEnabled;
     using BaseClass::kernelImmDatas;
     using BaseClass::setIsaGraphicsAllocations;
+    using BaseClass::sharedIsaAllocation;
     using BaseClass::symbols;
     using BaseClass::translationUnit;
     using BaseClass::type;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -56,6 +56,8 @@ class MockCommandListHw : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFam
                                              bool isStateless,
                                              CmdListKernelLaunchParams &launchParams) override {
         appendMemoryCopyKernelWithGACalledTimes++;
+        copyKernelDstOffsets.push_back(dstOffset);
+        copyKernelSrcOffsets.push_back(srcOffset);
         if (isStateless) {
             appendMemoryCopyKernelWithGAStatelessCalledTimes++;
         }
@@ -77,6 +79,8 @@ class MockCommandListHw : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFam
                                      uint64_t srcOffset,
                                      uint64_t size) override {
         appendMemoryCopyBlitCalledTimes++;
+        copyBlitDstOffsets.push_back(dstOffset);
+        copyBlitSrcOffsets.push_back(srcOffset);
         if (failOnFirstCopy && appendMemoryCopyBlitCalledTimes == 1) {
             return ZE_RESULT_ERROR_UNKNOWN;
         }
@@ -171,6 +175,10 @@ class MockCommandListHw : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFam
     uint32_t appendBlitFillCalledTimes = 0;
     uint32_t appendCopyImageBlitCalledTimes = 0;
     uint32_t getAlignedAllocationCalledTimes = 0;
+    std::vector<uint64_t> copyKernelDstOffsets;
+    std::vector<uint64_t> copyKernelSrcOffsets;
+    std::vector<uint64_t> copyBlitDstOffsets;
+    std::vector<uint64_t> copyBlitSrcOffsets;
     bool failOnFirstCopy = false;
     bool useEvents = false;
     bool failAlignedAlloc = false;
@@ -530,6 +538,68 @@ HWTEST2_F(CommandListAppend, givenCommandListWhen4GBytePageFaultCopyCalledThenPa
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 2u);
 }
 
+HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultRangeCopyCalledThenCopyKernelsUseRangeOffset, IsAtLeastSkl) {
+    MockCommandListHw<gfxCoreFamily> cmdList;
+    size_t offset = MemoryConstants::pageSize;
+    size_t size = ((sizeof(uint32_t) * 4) + 1);
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    auto ptr = reinterpret_cast<void *>(0x1234);
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+    auto canonizedGpuAddress = gmmHelper->canonize(castToUint64(ptr));
+    NEO::MockGraphicsAllocation mockAllocationSrc(0,
+                                                  AllocationType::internalHostMemory,
+                                                  ptr,
+                                                  offset + size,
+                                                  0u,
+                                                  MemoryPool::system4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    NEO::MockGraphicsAllocation mockAllocationDst(0,
+                                                  AllocationType::internalHostMemory,
+                                                  ptr,
+                                                  offset + size,
+                                                  0u,
+                                                  MemoryPool::system4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    cmdList.appendPageFaultRangeCopy(&mockAllocationDst, &mockAllocationSrc, offset, size, false);
+    ASSERT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 2u);
+    EXPECT_EQ(offset, cmdList.copyKernelDstOffsets[0]);
+    EXPECT_EQ(offset, cmdList.copyKernelSrcOffsets[0]);
+    EXPECT_EQ(offset + size - 1, cmdList.copyKernelDstOffsets[1]);
+    EXPECT_EQ(offset + size - 1, cmdList.copyKernelSrcOffsets[1]);
+}
+
+HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultRangeCopyCalledWithCopyEngineThenBlitUsesRangeOffset, IsAtLeastSkl) {
+    MockCommandListHw<gfxCoreFamily> cmdList;
+    size_t offset = MemoryConstants::pageSize;
+    size_t size = (sizeof(uint32_t) * 4);
+    cmdList.initialize(device, NEO::EngineGroupType::copy, 0u);
+    auto ptr = reinterpret_cast<void *>(0x1234);
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+    auto canonizedGpuAddress = gmmHelper->canonize(castToUint64(ptr));
+    NEO::MockGraphicsAllocation mockAllocationSrc(0,
+                                                  AllocationType::internalHostMemory,
+                                                  ptr,
+                                                  offset + size,
+                                                  0u,
+                                                  MemoryPool::system4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    NEO::MockGraphicsAllocation mockAllocationDst(0,
+                                                  AllocationType::internalHostMemory,
+                                                  ptr,
+                                                  offset + size,
+                                                  0u,
+                                                  MemoryPool::system4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    cmdList.appendPageFaultRangeCopy(&mockAllocationDst, &mockAllocationSrc, offset, size, false);
+    ASSERT_EQ(cmdList.appendMemoryCopyBlitCalledTimes, 1u);
+    EXPECT_EQ(offset, cmdList.copyBlitDstOffsets[0]);
+    EXPECT_EQ(offset, cmdList.copyBlitSrcOffsets[0]);
+}
+
 HWTEST2_F(CommandListAppend, givenCommandListAnd3DWhbufferenMemoryCopyRegionCalledThenCopyKernel3DCalled, IsAtLeastSkl) {
     MockCommandListHw<gfxCoreFamily> cmdList;
     cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,8 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdqueue.h"
 
+#include <thread>
+
 namespace NEO {
 namespace SysCalls {
 extern bool getNumThreadsCalled;
@@ -1474,6 +1476,49 @@ HWTEST2_F(ImmediateCommandListHostSynchronize, givenMaxTimeoutIsProvidedWaitPara
     EXPECT_TRUE(waitParams.indefinitelyPoll);
 }
 
+template <typename FamilyType, GFXCORE_FAMILY gfxCoreFamily>
+struct CsrOwnershipCheckingCommandListImmediateHw : public MockCommandListImmediateHw<gfxCoreFamily> {
+    ze_result_t hostSynchronize(uint64_t timeout, TaskCountType taskCount, bool handlePostWaitOperations) override {
+        std::thread([this]() {
+            auto ultCsr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(this->csr);
+            std::unique_lock<CommandStreamReceiver::MutexType> lock(ultCsr->ownershipMutex, std::try_to_lock);
+            csrOwnedDuringSynchronize = !lock.owns_lock();
+        }).join();
+        hostSynchronizeCalled++;
+        return MockCommandListImmediateHw<gfxCoreFamily>::hostSynchronize(timeout, taskCount, handlePostWaitOperations);
+    }
+
+    bool csrOwnedDuringSynchronize = false;
+    uint32_t hostSynchronizeCalled = 0;
+};
+
+HWTEST2_F(ImmediateCommandListHostSynchronize, givenSyncModeWhenReleaseCsrOwnershipBeforeSynchronizeIsEnabledThenCsrIsNotOwnedWhileWaitingForSubmission, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    auto csr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(device->getNEODevice()->getInternalEngine().commandStreamReceiver);
+    csr->callBaseWaitForCompletionWithTimeout = false;
+    csr->returnWaitForCompletionWithTimeout = WaitStatus::ready;
+
+    const ze_command_queue_desc_t desc = {};
+    auto commandQueue = new MockCommandQueueHw<gfxCoreFamily>(device, csr, &desc);
+    commandQueue->initialize(false, false, false);
+
+    auto cmdList = std::make_unique<CsrOwnershipCheckingCommandListImmediateHw<FamilyType, gfxCoreFamily>>();
+    cmdList->initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList->csr = csr;
+    cmdList->cmdQImmediate = commandQueue;
+    cmdList->isFlushTaskSubmissionEnabled = true;
+    cmdList->isSyncModeQueue = true;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(1u, cmdList->hostSynchronizeCalled);
+    EXPECT_TRUE(cmdList->csrOwnedDuringSynchronize);
+
+    debugManager.flags.ReleaseCsrOwnershipBeforeImmediateSynchronize.set(1);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(2u, cmdList->hostSynchronizeCalled);
+    EXPECT_FALSE(cmdList->csrOwnedDuringSynchronize);
+}
+
 using CommandListHostSynchronize = Test<DeviceFixture>;
 
 HWTEST2_F(CommandListHostSynchronize, whenHostSychronizeIsCalledReturnInvalidArgument, IsAtLeastSkl) {
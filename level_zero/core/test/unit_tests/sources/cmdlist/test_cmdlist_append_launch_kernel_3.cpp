@@ -15,6 +15,7 @@
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
+#include "shared/test/common/memory_manager/mock_prefetch_manager.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -1025,5 +1026,98 @@ HWTEST2_F(MultiTileImmediateCommandListAppendLaunchKernelXeHpCoreTest, givenImpl
     auto cmdBbStart = genCmdCast<MI_BATCH_BUFFER_START *>(*itorBbStart);
     EXPECT_EQ(MI_BATCH_BUFFER_START::SECOND_LEVEL_BATCH_BUFFER::SECOND_LEVEL_BATCH_BUFFER_SECOND_LEVEL_BATCH, cmdBbStart->getSecondLevelBatchBuffer());
 }
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenPredictiveUsmPrefetchDisabledWhenAppendingKernelUsingSharedAllocationThenMemoryPrefetchIsNotRequested, IsAtLeastSkl) {
+    createKernel();
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getDriverHandle()->getMemoryManager());
+    memoryManager->prefetchManager.reset(new MockPrefetchManager());
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    void *sharedPtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    result = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, 4096u, 1u, &sharedPtr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto sharedAllocation = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(sharedPtr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    kernel->residencyContainer.push_back(sharedAllocation);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    result = commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_FALSE(commandList->isMemoryPrefetchRequested());
+    EXPECT_EQ(0u, commandList->getPrefetchContext().allocations.size());
+
+    context->freeMem(sharedPtr);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenPredictiveUsmPrefetchEnabledWhenAppendingKernelsThenSharedAllocationsUsedByKernelAreAddedToPrefetchContextOnce, IsAtLeastSkl) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnablePredictiveUsmPrefetch.set(1);
+
+    createKernel();
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getDriverHandle()->getMemoryManager());
+    memoryManager->prefetchManager.reset(new MockPrefetchManager());
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    void *sharedPtr = nullptr;
+    void *devicePtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    result = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, 4096u, 1u, &sharedPtr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    result = context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 1u, &devicePtr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto svmManager = device->getDriverHandle()->getSvmAllocsManager();
+    kernel->residencyContainer.push_back(svmManager->getSVMAlloc(sharedPtr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex()));
+    kernel->residencyContainer.push_back(svmManager->getSVMAlloc(devicePtr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex()));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    result = commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    result = commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_TRUE(commandList->isMemoryPrefetchRequested());
+    ASSERT_EQ(1u, commandList->getPrefetchContext().allocations.size());
+    EXPECT_EQ(sharedPtr, commandList->getPrefetchContext().allocations[0]);
+    EXPECT_EQ(1u, memoryManager->prefetchManager->getPredictedAllocationsCount());
+
+    commandList->reset();
+    EXPECT_FALSE(commandList->isMemoryPrefetchRequested());
+    EXPECT_EQ(0u, commandList->getPrefetchContext().allocations.size());
+
+    context->freeMem(sharedPtr);
+    context->freeMem(devicePtr);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenPredictiveUsmPrefetchEnabledAndNoPrefetchManagerWhenAppendingKernelThenMemoryPrefetchIsNotRequested, IsAtLeastSkl) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnablePredictiveUsmPrefetch.set(1);
+
+    createKernel();
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getDriverHandle()->getMemoryManager());
+    memoryManager->prefetchManager.reset();
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    result = commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_FALSE(commandList->isMemoryPrefetchRequested());
+}
 } // namespace ult
 } // namespace L0
@@ -926,6 +926,96 @@ HWTEST_F(CommandQueueTest, givenCommandQueueWhenMakeResidentAndMigrateWithTwoAll
     EXPECT_EQ(csr.makeResidentCalledTimes, 2u);
     commandQueue->destroy();
 }
+HWTEST_F(CommandQueueTest, givenClosedCommandListWhenGettingResidencySetThenSetIsCachedUntilCommandListIsResetOrClosed) {
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+    MockGraphicsAllocation svmAllocation;
+    svmAllocation.allocationType = NEO::AllocationType::svmGpu;
+    MockGraphicsAllocation bufferAllocation;
+    commandList->getCmdContainer().addToResidencyContainer(&svmAllocation);
+    commandList->getCmdContainer().addToResidencyContainer(&bufferAllocation);
+    commandList->close();
+
+    auto &residencySet = commandList->getResidencySet();
+    ASSERT_EQ(1u, residencySet.migratableAllocations.size());
+    EXPECT_EQ(&svmAllocation, residencySet.migratableAllocations[0]);
+
+    auto cachedVersion = residencySet.version;
+    commandList->getResidencySet();
+    EXPECT_EQ(cachedVersion, residencySet.version);
+
+    commandList->close();
+    commandList->getResidencySet();
+    EXPECT_NE(cachedVersion, residencySet.version);
+    EXPECT_EQ(1u, residencySet.migratableAllocations.size());
+
+    commandList->reset();
+    commandList->close();
+    commandList->getResidencySet();
+    EXPECT_TRUE(residencySet.migratableAllocations.empty());
+}
+
+HWTEST_F(CommandQueueTest, givenCommandListMergedIntoSubmissionWhenMakingItResidentAgainInSameSubmissionThenAllocationsAreNotProcessedAgain) {
+    auto mockPageFaultManager = new MockPageFaultManager();
+    static_cast<MockMemoryManager *>(neoDevice->getExecutionEnvironment()->memoryManager.get())->pageFaultManager.reset(mockPageFaultManager);
+    MockCommandStreamReceiver csr(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    ze_result_t returnValue;
+    ze_command_queue_desc_t desc = {};
+    auto commandQueue = whiteboxCast(CommandQueue::create(productFamily, device, &csr, &desc, true, false, false, returnValue));
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+    MockGraphicsAllocation svmAllocation;
+    svmAllocation.allocationType = NEO::AllocationType::svmCpu;
+    MockGraphicsAllocation bufferAllocation;
+    commandList->getCmdContainer().getResidencyContainer().clear();
+    commandList->getCmdContainer().addToResidencyContainer(&svmAllocation);
+    commandList->getCmdContainer().addToResidencyContainer(&bufferAllocation);
+    commandList->close();
+
+    commandQueue->residencySetMergeId = CommandQueueImp::getNextResidencySetMergeId();
+    commandQueue->makeCommandListResidentAndMigrate(true, *commandList);
+    EXPECT_EQ(2u, csr.makeResidentCalledTimes);
+    EXPECT_EQ(1, mockPageFaultManager->moveAllocationToGpuDomainCalled);
+
+    commandQueue->makeCommandListResidentAndMigrate(true, *commandList);
+    EXPECT_EQ(2u, csr.makeResidentCalledTimes);
+    EXPECT_EQ(1, mockPageFaultManager->moveAllocationToGpuDomainCalled);
+
+    commandQueue->residencySetMergeId = CommandQueueImp::getNextResidencySetMergeId();
+    commandQueue->makeCommandListResidentAndMigrate(false, *commandList);
+    EXPECT_EQ(4u, csr.makeResidentCalledTimes);
+    EXPECT_EQ(1, mockPageFaultManager->moveAllocationToGpuDomainCalled);
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueTest, givenCommandListMergedByDestroyedQueueWhenNewQueueMergesItThenAllocationsAreProcessed) {
+    MockCommandStreamReceiver csr(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    ze_result_t returnValue;
+    ze_command_queue_desc_t desc = {};
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+    MockGraphicsAllocation bufferAllocation;
+    commandList->getCmdContainer().getResidencyContainer().clear();
+    commandList->getCmdContainer().addToResidencyContainer(&bufferAllocation);
+    commandList->close();
+
+    auto commandQueue = whiteboxCast(CommandQueue::create(productFamily, device, &csr, &desc, true, false, false, returnValue));
+    commandQueue->residencySetMergeId = CommandQueueImp::getNextResidencySetMergeId();
+    commandQueue->makeCommandListResidentAndMigrate(false, *commandList);
+    EXPECT_EQ(1u, csr.makeResidentCalledTimes);
+    auto previousMergeId = commandQueue->residencySetMergeId;
+    commandQueue->destroy();
+
+    commandQueue = whiteboxCast(CommandQueue::create(productFamily, device, &csr, &desc, true, false, false, returnValue));
+    commandQueue->residencySetMergeId = CommandQueueImp::getNextResidencySetMergeId();
+    EXPECT_NE(previousMergeId, commandQueue->residencySetMergeId);
+    commandQueue->makeCommandListResidentAndMigrate(false, *commandList);
+    EXPECT_EQ(2u, csr.makeResidentCalledTimes);
+    commandQueue->destroy();
+}
+
 HWTEST_F(CommandQueueTest, givenCommandQueueWhenPerformMigrationIsFalseThenTransferToGpuWasNotCalled) {
     auto mockPageFaultManager = new MockPageFaultManager();
     static_cast<MockMemoryManager *>(neoDevice->getExecutionEnvironment()->memoryManager.get())->pageFaultManager.reset(mockPageFaultManager);
@@ -8,6 +8,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/pause_on_gpu_properties.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/mocks/mock_bindless_heaps_helper.h"
 #include "shared/test/common/test_macros/hw_test.h"
@@ -75,6 +76,95 @@ HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, GivenAsynchronousModeWhenEx
     mockCmdQ->destroy();
 }
 
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenSubmissionStateCacheEnabledWhenSameCommandListIsExecutedRepeatedlyThenStateTrackingResultIsReusedUntilCommandListChanges, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableSubmissionStateCache.set(1);
+
+    ze_command_queue_desc_t desc;
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    auto mockCmdQ = new MockCommandQueueHw<gfxCoreFamily>(device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQ->initialize(false, false, false);
+    ze_result_t returnValue;
+    ze_command_list_handle_t commandLists[] = {
+        CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false)->toHandle()};
+    auto commandList = CommandList::fromHandle(commandLists[0]);
+    commandList->close();
+
+    for (uint32_t i = 0; i < 4 && mockCmdQ->submissionStateCache.steadyExecutions < 2; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(1, commandLists, nullptr, false));
+    }
+    ASSERT_EQ(2u, mockCmdQ->submissionStateCache.steadyExecutions);
+
+    auto usedBefore = mockCmdQ->commandStream.getUsed();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(1, commandLists, nullptr, false));
+    auto usedPerExecution = mockCmdQ->commandStream.getUsed() - usedBefore;
+    EXPECT_EQ(2u, mockCmdQ->submissionStateCache.steadyExecutions);
+
+    usedBefore = mockCmdQ->commandStream.getUsed();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(1, commandLists, nullptr, false));
+    EXPECT_EQ(usedPerExecution, mockCmdQ->commandStream.getUsed() - usedBefore);
+    EXPECT_EQ(2u, mockCmdQ->submissionStateCache.steadyExecutions);
+
+    commandList->reset();
+    commandList->close();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(1, commandLists, nullptr, false));
+    EXPECT_GE(1u, mockCmdQ->submissionStateCache.steadyExecutions);
+
+    commandList->destroy();
+    mockCmdQ->destroy();
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenSubmissionStateCacheWhenCommandListIsDestroyedAndNewOneIsExecutedThenCachedStateTrackingResultIsNotUsed, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableSubmissionStateCache.set(1);
+
+    ze_command_queue_desc_t desc;
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    auto mockCmdQ = new MockCommandQueueHw<gfxCoreFamily>(device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQ->initialize(false, false, false);
+    ze_result_t returnValue;
+    ze_command_list_handle_t commandLists[] = {
+        CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false)->toHandle()};
+    CommandList::fromHandle(commandLists[0])->close();
+
+    for (uint32_t i = 0; i < 4 && mockCmdQ->submissionStateCache.steadyExecutions < 2; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(1, commandLists, nullptr, false));
+    }
+    ASSERT_EQ(2u, mockCmdQ->submissionStateCache.steadyExecutions);
+    auto destroyedListId = CommandList::fromHandle(commandLists[0])->getStateTrackingId();
+    CommandList::fromHandle(commandLists[0])->destroy();
+
+    commandLists[0] = CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false)->toHandle();
+    CommandList::fromHandle(commandLists[0])->close();
+    EXPECT_NE(destroyedListId, CommandList::fromHandle(commandLists[0])->getStateTrackingId());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(1, commandLists, nullptr, false));
+    EXPECT_GE(1u, mockCmdQ->submissionStateCache.steadyExecutions);
+
+    CommandList::fromHandle(commandLists[0])->destroy();
+    mockCmdQ->destroy();
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenSubmissionStateCacheDisabledWhenSameCommandListIsExecutedRepeatedlyThenStateTrackingResultIsNotRecorded, IsAtLeastSkl) {
+    ze_command_queue_desc_t desc;
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    auto mockCmdQ = new MockCommandQueueHw<gfxCoreFamily>(device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQ->initialize(false, false, false);
+    ze_result_t returnValue;
+    ze_command_list_handle_t commandLists[] = {
+        CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false)->toHandle()};
+    CommandList::fromHandle(commandLists[0])->close();
+
+    for (uint32_t i = 0; i < 4; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(1, commandLists, nullptr, false));
+    }
+    EXPECT_EQ(0u, mockCmdQ->submissionStateCache.steadyExecutions);
+    EXPECT_TRUE(mockCmdQ->submissionStateCache.commandListIds.empty());
+
+    CommandList::fromHandle(commandLists[0])->destroy();
+    mockCmdQ->destroy();
+}
+
 HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, whenUsingFenceThenLastPipeControlUpdatesFenceAllocation, IsAtLeastSkl) {
     using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
     using POST_SYNC_OPERATION = typename FamilyType::PIPE_CONTROL::POST_SYNC_OPERATION;
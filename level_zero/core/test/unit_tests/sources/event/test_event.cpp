@@ -25,6 +25,7 @@
 #include "level_zero/core/source/context/context_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/event/event_completion_monitor.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/event_fixture.h"
@@ -42,6 +43,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <thread>
 
 using namespace std::chrono_literals;
 
@@ -1572,6 +1574,52 @@ TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutZeroWhenO
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(EventSynchronizeTest, givenEventCompletionMonitorDisabledWhenGettingMonitorThenNullptrIsReturned) {
+    auto driverHandleImp = static_cast<DriverHandleImp *>(driverHandle.get());
+    EXPECT_FALSE(EventCompletionMonitor::isEnabled());
+    EXPECT_EQ(nullptr, driverHandleImp->getEventCompletionMonitor());
+    EXPECT_EQ(nullptr, driverHandleImp->eventCompletionMonitor.get());
+}
+
+TEST_F(EventSynchronizeTest, givenEventCompletionMonitorEnabledWhenHostSynchronizeIsCalledWithNonZeroTimeoutThenMonitorIsCreatedAndUsedForWaiting) {
+    DebugManagerStateRestore restore;
+    NEO::debugManager.flags.EnableEventCompletionMonitor.set(1);
+    auto driverHandleImp = static_cast<DriverHandleImp *>(driverHandle.get());
+
+    event->setUsingContextEndOffset(false);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->hostSynchronize(0));
+    EXPECT_EQ(nullptr, driverHandleImp->eventCompletionMonitor.get());
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->hostSynchronize(10000));
+    auto completionMonitor = driverHandleImp->eventCompletionMonitor.get();
+    ASSERT_NE(nullptr, completionMonitor);
+
+    uint32_t *hostAddr = static_cast<uint32_t *>(event->getHostAddress());
+    *hostAddr = Event::STATE_SIGNALED;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(completionMonitor, driverHandleImp->getEventCompletionMonitor());
+}
+
+TEST_F(EventSynchronizeTest, givenEventCompletionMonitorWhenEventIsSignaledByAnotherThreadThenWaiterIsWokenUp) {
+    DebugManagerStateRestore restore;
+    NEO::debugManager.flags.EventCompletionMonitorPollPeriod.set(1);
+    EventCompletionMonitor completionMonitor;
+
+    event->setUsingContextEndOffset(false);
+    volatile uint32_t *hostAddr = static_cast<uint32_t *>(event->getHostAddress());
+
+    std::thread signalingThread([hostAddr]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        *hostAddr = Event::STATE_SIGNALED;
+    });
+
+    auto result = completionMonitor.waitForCompletion(*event, std::chrono::seconds(10));
+    signalingThread.join();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, completionMonitor.waitForCompletion(*event, std::chrono::nanoseconds(0)));
+}
+
 TEST_F(EventUsedPacketSignalSynchronizeTest, givenInfiniteTimeoutWhenWaitingForNonTimestampEventCompletionThenReturnOnlyAfterAllEventPacketsAreCompleted) {
     constexpr uint32_t packetsInUse = 2;
     event->setPacketsInUse(packetsInUse);
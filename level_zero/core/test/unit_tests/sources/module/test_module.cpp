@@ -20,6 +20,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/os_interface/os_inc_base.h"
+#include "shared/source/program/isa_pool_allocator.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
@@ -170,6 +171,169 @@ HWTEST_F(ModuleKernelIsaAllocationsInSharedMemoryTests, givenSeparateIsaMemoryRe
     this->givenSeparateIsaMemoryRegionPerKernelWhenGraphicsAllocationFailsThenProperErrorReturned();
 }
 
+struct LazyKernelInitializationModule : public WhiteBox<::L0::Module> {
+    using WhiteBox<::L0::Module>::WhiteBox;
+
+    size_t computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize) override {
+        if (separateIsaAllocations) {
+            return 2 * MemoryConstants::pageSize64k;
+        }
+        return WhiteBox<::L0::Module>::computeKernelIsaAllocationAlignedSizeWithPadding(isaSize);
+    }
+
+    bool separateIsaAllocations = false;
+};
+
+struct LazyKernelInitializationTest : public ModuleTest {
+    void createLazyModule(ModuleType type, bool separateIsaAllocations) {
+        this->module.reset();
+        auto lazyModule = new LazyKernelInitializationModule{device, nullptr, type};
+        lazyModule->separateIsaAllocations = separateIsaAllocations;
+        this->module.reset(lazyModule);
+        createModuleFromMockBinary(type);
+        ASSERT_LT(1u, module->kernelImmDatas.size());
+    }
+};
+
+HWTEST_F(LazyKernelInitializationTest, givenDefaultSettingsWhenModuleIsCreatedThenAllKernelsAreInitializedAndIsaIsUploaded) {
+    createLazyModule(ModuleType::user, true);
+
+    for (auto &kernelImmData : module->kernelImmDatas) {
+        EXPECT_TRUE(kernelImmData->isInitialized());
+        EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+    }
+}
+
+HWTEST_F(LazyKernelInitializationTest, givenLazyKernelInitializationAndSeparateIsaAllocationsWhenKernelIsCreatedThenOnlyThisKernelIsInitializedAndUploaded) {
+    debugManager.flags.EnableLazyKernelInitialization.set(1);
+    createLazyModule(ModuleType::user, true);
+    ASSERT_EQ(nullptr, module->getKernelsIsaParentAllocation());
+
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->getKernelNames(&count, nullptr));
+    EXPECT_EQ(module->kernelImmDatas.size(), count);
+    for (auto &kernelImmData : module->kernelImmDatas) {
+        EXPECT_FALSE(kernelImmData->isInitialized());
+        EXPECT_FALSE(kernelImmData->isIsaCopiedToAllocation());
+        EXPECT_NE(nullptr, kernelImmData->getIsaGraphicsAllocation());
+    }
+
+    auto &createdKernelImmData = module->kernelImmDatas[0];
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = createdKernelImmData->getDescriptor().kernelMetadata.kernelName.c_str();
+
+    for (auto i = 0u; i < 2; i++) {
+        ze_kernel_handle_t kernelHandle = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, module->createKernel(&kernelDesc, &kernelHandle));
+        EXPECT_TRUE(createdKernelImmData->isInitialized());
+        EXPECT_TRUE(createdKernelImmData->isIsaCopiedToAllocation());
+        Kernel::fromHandle(kernelHandle)->destroy();
+    }
+
+    for (auto i = 1u; i < module->kernelImmDatas.size(); i++) {
+        EXPECT_FALSE(module->kernelImmDatas[i]->isInitialized());
+        EXPECT_FALSE(module->kernelImmDatas[i]->isIsaCopiedToAllocation());
+    }
+}
+
+HWTEST_F(LazyKernelInitializationTest, givenLazyKernelInitializationAndSeparateIsaAllocationsWhenGettingKernelFunctionPointerThenKernelIsaIsUploaded) {
+    debugManager.flags.EnableLazyKernelInitialization.set(1);
+    createLazyModule(ModuleType::user, true);
+
+    auto &kernelImmData = module->kernelImmDatas[0];
+    void *functionPointer = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->getFunctionPointer(kernelImmData->getDescriptor().kernelMetadata.kernelName.c_str(), &functionPointer));
+    EXPECT_NE(nullptr, functionPointer);
+    EXPECT_TRUE(kernelImmData->isInitialized());
+    EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+}
+
+HWTEST_F(LazyKernelInitializationTest, givenLazyKernelInitializationAndIsaSharedBetweenKernelsWhenModuleIsCreatedThenWholeIsaIsUploadedAndKernelsAreNotInitialized) {
+    debugManager.flags.EnableLazyKernelInitialization.set(1);
+    createLazyModule(ModuleType::user, false);
+    ASSERT_NE(nullptr, module->getKernelsIsaParentAllocation());
+
+    for (auto &kernelImmData : module->kernelImmDatas) {
+        EXPECT_FALSE(kernelImmData->isInitialized());
+        EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+    }
+}
+
+HWTEST_F(LazyKernelInitializationTest, givenLazyKernelInitializationAndBuiltinModuleWhenModuleIsCreatedThenAllKernelsAreInitialized) {
+    debugManager.flags.EnableLazyKernelInitialization.set(1);
+    createLazyModule(ModuleType::builtin, false);
+
+    for (auto &kernelImmData : module->kernelImmDatas) {
+        EXPECT_TRUE(kernelImmData->isInitialized());
+    }
+}
+
+using IsaPoolingModuleTest = ModuleTest;
+
+HWTEST_F(IsaPoolingModuleTest, givenIsaPoolingEnabledWhenModuleIsCreatedThenKernelsIsaIsSubAllocatedFromDevicePool) {
+    debugManager.flags.EnableIsaPooling.set(1);
+    this->module.reset();
+    createModuleFromMockBinary(ModuleType::user);
+
+    auto sharedIsaAllocation = module->sharedIsaAllocation;
+    ASSERT_NE(nullptr, sharedIsaAllocation);
+    EXPECT_EQ(sharedIsaAllocation->getGraphicsAllocation(), module->getKernelsIsaParentAllocation());
+    for (auto &kernelImmData : module->kernelImmDatas) {
+        EXPECT_EQ(sharedIsaAllocation->getGraphicsAllocation(), kernelImmData->getIsaGraphicsAllocation());
+        EXPECT_LE(sharedIsaAllocation->getOffset(), kernelImmData->getIsaOffsetInParentAllocation());
+        EXPECT_GE(sharedIsaAllocation->getOffset() + sharedIsaAllocation->getSize(), kernelImmData->getIsaOffsetInParentAllocation() + kernelImmData->getIsaSize());
+        EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+    }
+}
+
+HWTEST_F(IsaPoolingModuleTest, givenIsaPoolingEnabledWhenModulesWithIdenticalRelocationFreeIsaAreCreatedThenIsaIsShared) {
+    debugManager.flags.EnableIsaPooling.set(1);
+    this->module.reset();
+    createModuleFromMockBinary(ModuleType::user);
+    ASSERT_TRUE(module->isaDeduplicationAllowed);
+    auto firstModule = std::move(this->module);
+    EXPECT_EQ(1u, device->getNEODevice()->getIsaPoolAllocator().getDeduplicatedIsaCount());
+
+    createModuleFromMockBinary(ModuleType::user);
+    ASSERT_NE(nullptr, module->sharedIsaAllocation);
+    EXPECT_EQ(firstModule->sharedIsaAllocation, module->sharedIsaAllocation);
+    for (auto i = 0u; i < module->kernelImmDatas.size(); i++) {
+        EXPECT_EQ(firstModule->kernelImmDatas[i]->getIsaOffsetInParentAllocation(), module->kernelImmDatas[i]->getIsaOffsetInParentAllocation());
+        EXPECT_TRUE(module->kernelImmDatas[i]->isIsaCopiedToAllocation());
+    }
+
+    firstModule.reset();
+    EXPECT_EQ(1u, device->getNEODevice()->getIsaPoolAllocator().getDeduplicatedIsaCount());
+    this->module.reset();
+    EXPECT_EQ(0u, device->getNEODevice()->getIsaPoolAllocator().getDeduplicatedIsaCount());
+}
+
+HWTEST_F(IsaPoolingModuleTest, givenIsaPoolingEnabledWhenUserAndBuiltinModulesWithIdenticalIsaAreCreatedThenIsaIsNotShared) {
+    debugManager.flags.EnableIsaPooling.set(1);
+    this->module.reset();
+    createModuleFromMockBinary(ModuleType::user);
+    auto userModule = std::move(this->module);
+
+    createModuleFromMockBinary(ModuleType::builtin);
+    ASSERT_NE(nullptr, module->sharedIsaAllocation);
+    EXPECT_NE(userModule->sharedIsaAllocation, module->sharedIsaAllocation);
+    EXPECT_EQ(NEO::AllocationType::kernelIsaInternal, module->getKernelsIsaParentAllocation()->getAllocationType());
+}
+
+HWTEST_F(IsaPoolingModuleTest, givenIsaPoolingEnabledAndIsaRequiringRelocationsWhenCheckingDeduplicationThenItIsNotAllowed) {
+    debugManager.flags.EnableIsaPooling.set(1);
+    this->module.reset();
+    createModuleFromMockBinary(ModuleType::user);
+
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->traits.requiresPatchingOfInstructionSegments = true;
+    module->translationUnit->programInfo.linkerInput = std::move(linkerInput);
+    EXPECT_FALSE(module->isIsaDeduplicationAllowed());
+
+    module->translationUnit->programInfo.linkerInput.reset();
+    EXPECT_TRUE(module->isIsaDeduplicationAllowed());
+}
+
 HWTEST_F(ModuleTest, givenBuiltinModuleWhenCreatedThenCorrectAllocationTypeIsUsedForIsa) {
     this->module.reset();
     createModuleFromMockBinary(ModuleType::builtin);
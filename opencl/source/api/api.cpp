@@ -3908,6 +3908,11 @@ CL_API_ENTRY void *CL_API_CALL clHostMemAllocINTEL(
         return allocationFromPool;
     }
 
+    allocationFromPool = neoContext->getHostMemAllocPoolsManager().createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    if (allocationFromPool) {
+        return allocationFromPool;
+    }
+
     return neoContext->getSVMAllocsManager()->createHostUnifiedMemoryAllocation(size, unifiedMemoryProperties);
 }
 
@@ -3962,6 +3967,11 @@ CL_API_ENTRY void *CL_API_CALL clDeviceMemAllocINTEL(
         return allocationFromPool;
     }
 
+    allocationFromPool = neoContext->getDeviceMemAllocPoolsManager().createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    if (allocationFromPool) {
+        return allocationFromPool;
+    }
+
     return neoContext->getSVMAllocsManager()->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
 }
 
@@ -4017,6 +4027,12 @@ CL_API_ENTRY void *CL_API_CALL clSharedMemAllocINTEL(
         err.set(CL_INVALID_BUFFER_SIZE);
         return nullptr;
     }
+
+    auto allocationFromPool = neoContext->getSharedMemAllocPoolsManager().createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    if (allocationFromPool) {
+        return allocationFromPool;
+    }
+
     auto ptr = neoContext->getSVMAllocsManager()->createSharedUnifiedMemoryAllocation(size, unifiedMemoryProperties, neoContext->getSpecialQueue(neoDevice->getRootDeviceIndex()));
     if (!ptr) {
         err.set(CL_OUT_OF_RESOURCES);
@@ -4043,6 +4059,12 @@ CL_API_ENTRY cl_int CL_API_CALL clMemFreeCommon(cl_context context,
         return CL_SUCCESS;
     }
 
+    for (auto poolsManager : {&neoContext->getDeviceMemAllocPoolsManager(), &neoContext->getHostMemAllocPoolsManager(), &neoContext->getSharedMemAllocPoolsManager()}) {
+        if (ptr && poolsManager->freeSVMAlloc(const_cast<void *>(ptr), blocking)) {
+            return CL_SUCCESS;
+        }
+    }
+
     if (ptr && !neoContext->getSVMAllocsManager()->freeSVMAlloc(const_cast<void *>(ptr), blocking)) {
         return CL_INVALID_VALUE;
     }
@@ -4116,6 +4138,11 @@ CL_API_ENTRY cl_int CL_API_CALL clGetMemAllocInfoINTEL(
         if (auto basePtrFromHostPool = pContext->getHostMemAllocPool().getPooledAllocationBasePtr(ptr)) {
             return changeGetInfoStatusToCLResultType(info.set<uint64_t>(castToUint64(basePtrFromHostPool)));
         }
+        for (auto poolsManager : {&pContext->getDeviceMemAllocPoolsManager(), &pContext->getHostMemAllocPoolsManager(), &pContext->getSharedMemAllocPoolsManager()}) {
+            if (auto basePtrFromPoolsManager = poolsManager->getPooledAllocationBasePtr(ptr)) {
+                return changeGetInfoStatusToCLResultType(info.set<uint64_t>(castToUint64(basePtrFromPoolsManager)));
+            }
+        }
         return changeGetInfoStatusToCLResultType(info.set<uint64_t>(unifiedMemoryAllocation->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
     }
     case CL_MEM_ALLOC_SIZE_INTEL: {
@@ -4128,6 +4155,11 @@ CL_API_ENTRY cl_int CL_API_CALL clGetMemAllocInfoINTEL(
         if (auto sizeFromHostPool = pContext->getHostMemAllocPool().getPooledAllocationSize(ptr)) {
             return changeGetInfoStatusToCLResultType(info.set<size_t>(sizeFromHostPool));
         }
+        for (auto poolsManager : {&pContext->getDeviceMemAllocPoolsManager(), &pContext->getHostMemAllocPoolsManager(), &pContext->getSharedMemAllocPoolsManager()}) {
+            if (auto sizeFromPoolsManager = poolsManager->getPooledAllocationSize(ptr)) {
+                return changeGetInfoStatusToCLResultType(info.set<size_t>(sizeFromPoolsManager));
+            }
+        }
         return changeGetInfoStatusToCLResultType(info.set<size_t>(unifiedMemoryAllocation->size));
     }
     case CL_MEM_ALLOC_FLAGS_INTEL: {
@@ -525,11 +525,34 @@ void Context::initializeUsmAllocationPools() {
                                                                    getRootDeviceIndices(), subDeviceBitfields);
         usmHostMemAllocPool.initialize(svmMemoryManager, memoryProperties, poolSize);
     }
+
+    if (UsmMemAllocPoolsManager::isEnabled()) {
+        auto subDeviceBitfields = getDeviceBitfields();
+        auto &neoDevice = devices[0]->getDevice();
+        subDeviceBitfields[neoDevice.getRootDeviceIndex()] = neoDevice.getDeviceBitfield();
+
+        SVMAllocsManager::UnifiedMemoryProperties deviceMemoryProperties(InternalMemoryType::deviceUnifiedMemory, MemoryConstants::pageSize2M,
+                                                                         getRootDeviceIndices(), subDeviceBitfields);
+        deviceMemoryProperties.device = &neoDevice;
+        usmDeviceMemAllocPoolsManager.initialize(svmMemoryManager, deviceMemoryProperties, nullptr);
+
+        SVMAllocsManager::UnifiedMemoryProperties hostMemoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize2M,
+                                                                       getRootDeviceIndices(), subDeviceBitfields);
+        usmHostMemAllocPoolsManager.initialize(svmMemoryManager, hostMemoryProperties, nullptr);
+
+        SVMAllocsManager::UnifiedMemoryProperties sharedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, MemoryConstants::pageSize2M,
+                                                                         getRootDeviceIndices(), subDeviceBitfields);
+        sharedMemoryProperties.device = &neoDevice;
+        usmSharedMemAllocPoolsManager.initialize(svmMemoryManager, sharedMemoryProperties, getSpecialQueue(neoDevice.getRootDeviceIndex()));
+    }
 }
 
 void Context::cleanupUsmAllocationPools() {
     usmDeviceMemAllocPool.cleanup();
     usmHostMemAllocPool.cleanup();
+    usmDeviceMemAllocPoolsManager.cleanup();
+    usmHostMemAllocPoolsManager.cleanup();
+    usmSharedMemAllocPoolsManager.cleanup();
 }
 
 bool Context::BufferPoolAllocator::isAggregatedSmallBuffersEnabled(Context *context) const {
@@ -246,6 +246,15 @@ class Context : public BaseObject<_cl_context> {
     UsmMemAllocPool &getHostMemAllocPool() {
         return usmHostMemAllocPool;
     }
+    UsmMemAllocPoolsManager &getDeviceMemAllocPoolsManager() {
+        return usmDeviceMemAllocPoolsManager;
+    }
+    UsmMemAllocPoolsManager &getHostMemAllocPoolsManager() {
+        return usmHostMemAllocPoolsManager;
+    }
+    UsmMemAllocPoolsManager &getSharedMemAllocPoolsManager() {
+        return usmSharedMemAllocPoolsManager;
+    }
 
     TagAllocatorBase *getMultiRootDeviceTimestampPacketAllocator();
     std::unique_lock<std::mutex> obtainOwnershipForMultiRootDeviceAllocator();
@@ -293,6 +302,9 @@ class Context : public BaseObject<_cl_context> {
     BufferPoolAllocator smallBufferPoolAllocator;
     UsmDeviceMemAllocPool usmDeviceMemAllocPool;
     UsmHostMemAllocPool usmHostMemAllocPool;
+    UsmMemAllocPoolsManager usmDeviceMemAllocPoolsManager;
+    UsmMemAllocPoolsManager usmHostMemAllocPoolsManager;
+    UsmMemAllocPoolsManager usmSharedMemAllocPoolsManager;
 
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     cl_bool preferD3dSharedResources = 0u;
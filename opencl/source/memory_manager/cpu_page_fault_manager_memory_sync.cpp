@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
@@ -33,6 +34,24 @@ void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     UNRECOVERABLE_IF(allocData == nullptr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
+void PageFaultManager::transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto retVal = commandQueue->enqueueSVMMap(true, CL_MAP_WRITE, ptrOffset(ptr, offset), size, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+}
+void PageFaultManager::transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto rangePtr = ptrOffset(ptr, offset);
+    memoryData[ptr].unifiedMemoryManager->insertSvmMapOperation(rangePtr, size, ptr, offset, false);
+    auto retVal = commandQueue->enqueueSVMUnmap(rangePtr, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+    retVal = commandQueue->finish();
+    UNRECOVERABLE_IF(retVal);
+
+    auto allocData = memoryData[ptr].unifiedMemoryManager->getSVMAlloc(ptr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
     auto commandQueue = static_cast<CommandQueue *>(pageFaultData.cmdQ);
 
@@ -489,13 +489,25 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
     }
     volatile TagAddressType *partitionAddress = pollAddress;
 
+    const bool adaptiveWait = WaitUtils::waitPolicy == WaitUtils::WaitPolicy::adaptive;
+    auto waitPhase = WaitUtils::AdaptiveWaitState::Phase::spin;
+    bool waited = false;
+
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
+    currentTime = waitStartTime;
     for (uint32_t i = 0; i < activePartitions; i++) {
         while (*partitionAddress < taskCountToWait && timeDiff <= params.waitTimeout) {
             this->downloadTagAllocation(taskCountToWait);
+            waited = true;
 
-            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait)) {
+            if (adaptiveWait) {
+                // indefinite polls go through adaptive waiter as well, so infinite waits do not busy spin and every recorded wait used it
+                waitPhase = adaptiveWaitState.getPhase(std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count());
+                if (WaitUtils::adaptiveWaitFunction(partitionAddress, taskCountToWait, waitPhase)) {
+                    break;
+                }
+            } else if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait)) {
                 break;
             }
 
@@ -520,6 +532,11 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         partitionAddress = ptrOffset(partitionAddress, this->immWritePostSyncWriteOffset);
     }
 
+    if (adaptiveWait && waited) {
+        currentTime = std::chrono::high_resolution_clock::now();
+        adaptiveWaitState.recordWait(std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count(), waitPhase);
+    }
+
     return WaitStatus::ready;
 }
 
@@ -15,6 +15,7 @@
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/utilities/spinlock.h"
+#include "shared/source/utilities/wait_util.h"
 
 #include "aubstream/allocation_params.h"
 
@@ -147,6 +148,7 @@ class CommandStreamReceiver {
     TaskCountType getNextBarrierCount() { return this->barrierCount.fetch_add(1u); }
     TaskCountType peekBarrierCount() const { return this->barrierCount.load(); }
     volatile TagAddressType *getTagAddress() const { return tagAddress; }
+    const WaitUtils::AdaptiveWaitState &getAdaptiveWaitState() const { return adaptiveWaitState; }
     volatile TagAddressType *getBarrierCountTagAddress() const { return this->barrierCountTagAddress; }
     uint64_t getBarrierCountGpuAddress() const;
     uint64_t getDebugPauseStateGPUAddress() const;
@@ -505,6 +507,7 @@ class CommandStreamReceiver {
 
     volatile TagAddressType *tagAddress = nullptr;
     volatile TagAddressType *barrierCountTagAddress = nullptr;
+    WaitUtils::AdaptiveWaitState adaptiveWaitState;
     volatile DebugPauseState *debugPauseStateAddress = nullptr;
     SpinLock debugPauseStateLock;
     static void *asyncDebugBreakConfirmation(void *arg);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,11 +7,13 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 
+#include "shared/source/compiler_interface/compiler_cache_archive.h"
+#include "shared/source/compiler_interface/compiler_cache_lru.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/casts.h"
 #include "shared/source/helpers/file_io.h"
-#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 #include "shared/source/utilities/io_functions.h"
@@ -19,6 +21,7 @@
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iomanip>
 #include <mutex>
@@ -32,8 +35,9 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
                                                    const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
                                                    const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
-    Hash hash;
+    Hash128 hash;
 
+    hash.update(safePodCast<const char *>(&cacheKeyVersion), sizeof(cacheKeyVersion));
     hash.update("----", 4);
     hash.update(&*igcRevision.begin(), igcRevision.size());
     hash.update(safePodCast<const char *>(&igcLibSize), sizeof(igcLibSize));
@@ -62,9 +66,11 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     auto res = hash.finish();
     std::stringstream stream;
     stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
            << std::hex
-           << res;
+           << std::setw(sizeof(res.high) * 2)
+           << res.high
+           << std::setw(sizeof(res.low) * 2)
+           << res.low;
 
     if (debugManager.flags.BinaryCacheTrace.get()) {
         std::string traceFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".trace";
@@ -132,7 +138,61 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     return stream.str();
 }
 
+const std::string CompilerCache::getArchiveFileName() const {
+    std::string archiveFileName = "cache_archive" + config.cacheFileExtension;
+    std::replace(archiveFileName.begin(), archiveFileName.end(), '.', '_');
+    return archiveFileName;
+}
+
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
-    : config(cacheConfig){};
+    : config(cacheConfig) {
+    if (debugManager.flags.EnableCompilerCacheArchive.get() != -1) {
+        config.useArchive = !!debugManager.flags.EnableCompilerCacheArchive.get();
+    }
+
+    size_t inMemoryCacheSize = defaultInMemoryCacheSize;
+    if (debugManager.flags.CompilerCacheInMemorySize.get() != -1) {
+        inMemoryCacheSize = static_cast<size_t>(debugManager.flags.CompilerCacheInMemorySize.get());
+    }
+    if (inMemoryCacheSize > 0u) {
+        inMemoryCache = std::make_unique<CompilerCacheLru>(inMemoryCacheSize);
+    }
+};
+
+CompilerCache::~CompilerCache() {
+    if (inMemoryCache) {
+        printDebugString(debugManager.flags.PrintCompilerCacheInMemoryStatistics.get(), stdout,
+                         "Compiler cache in-memory statistics: hits: %llu, misses: %llu, entries: %zu, used bytes: %zu\n",
+                         static_cast<unsigned long long>(inMemoryCache->getHits()), static_cast<unsigned long long>(inMemoryCache->getMisses()),
+                         inMemoryCache->getNumEntries(), inMemoryCache->getUsedBytes());
+    }
+    closeArchive();
+}
+
+bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (pBinary == nullptr || binarySize == 0) {
+        return false;
+    }
+
+    if (inMemoryCache) {
+        inMemoryCache->store(kernelFileHash, pBinary, binarySize);
+    }
+    return cacheBinaryOnDisk(kernelFileHash, pBinary, binarySize);
+}
+
+std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    if (inMemoryCache) {
+        auto binary = inMemoryCache->load(kernelFileHash, cachedBinarySize);
+        if (binary) {
+            return binary;
+        }
+    }
+
+    auto binary = loadCachedBinaryFromDisk(kernelFileHash, cachedBinarySize);
+    if (binary && inMemoryCache) {
+        inMemoryCache->store(kernelFileHash, binary.get(), cachedBinarySize);
+    }
+    return binary;
+}
 
 } // namespace NEO
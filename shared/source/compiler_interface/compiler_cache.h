@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,18 +18,25 @@
 
 namespace NEO {
 struct HardwareInfo;
+class CompilerCacheArchive;
+class CompilerCacheLru;
 
 struct CompilerCacheConfig {
     bool enabled = true;
     std::string cacheFileExtension;
     std::string cacheDir;
     size_t cacheSize = 0;
+    bool useArchive = false;
 };
 
 class CompilerCache {
   public:
+    static constexpr size_t defaultInMemoryCacheSize = 0u;
+    // bump whenever the key derivation changes, so that entries created with the old scheme are never matched
+    static constexpr uint32_t cacheKeyVersion = 2u;
+
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -38,6 +45,9 @@ class CompilerCache {
     const CompilerCacheConfig &getConfig() {
         return config;
     }
+    CompilerCacheLru *getInMemoryCache() const {
+        return inMemoryCache.get();
+    }
 
     const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                         ArrayRef<const char> options, ArrayRef<const char> internalOptions,
@@ -48,12 +58,27 @@ class CompilerCache {
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
 
   protected:
+    MOCKABLE_VIRTUAL bool cacheBinaryOnDisk(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinaryFromDisk(const std::string &kernelFileHash, size_t &cachedBinarySize);
     MOCKABLE_VIRTUAL bool evictCache(uint64_t &bytesEvicted);
     MOCKABLE_VIRTUAL bool renameTempFileBinaryToProperName(const std::string &oldName, const std::string &kernelFileHash);
     MOCKABLE_VIRTUAL bool createUniqueTempFileAndWriteData(char *tmpFilePathTemplate, const char *pBinary, size_t binarySize);
     MOCKABLE_VIRTUAL void lockConfigFileAndReadSize(const std::string &configFilePath, UnifiedHandle &fd, size_t &directorySize);
 
+    MOCKABLE_VIRTUAL bool openArchive();
+    void closeArchive();
+    const std::string getArchiveFileName() const;
+    bool cacheBinaryInArchive(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    std::unique_ptr<char[]> loadCachedBinaryFromArchive(const std::string &kernelFileHash, size_t &cachedBinarySize);
+
     static std::mutex cacheAccessMtx;
     CompilerCacheConfig config;
+
+    std::unique_ptr<CompilerCacheLru> inMemoryCache;
+
+    std::unique_ptr<CompilerCacheArchive> archive;
+    void *archiveMapping = nullptr;
+    size_t archiveMappingSize = 0u;
+    UnifiedHandle archiveHandle{-1};
 };
 } // namespace NEO
@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_archive.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/string.h"
+
+#include <cstring>
+#include <vector>
+
+namespace NEO {
+
+namespace {
+constexpr size_t getIndexOffset() {
+    return alignUp(sizeof(CompilerCacheArchive::Header), CompilerCacheArchive::dataAlignment);
+}
+
+constexpr size_t getDataOffset(uint32_t indexEntriesCount) {
+    return alignUp(getIndexOffset() + indexEntriesCount * sizeof(CompilerCacheArchive::IndexEntry), CompilerCacheArchive::dataAlignment);
+}
+} // namespace
+
+uint32_t CompilerCacheArchive::getIndexEntriesCount(size_t dataCapacity) {
+    // assume 64KB per binary on average
+    uint64_t entries = Math::nextPowerOfTwo(static_cast<uint64_t>(dataCapacity / MemoryConstants::pageSize64k));
+    return static_cast<uint32_t>(std::clamp<uint64_t>(entries, minIndexEntries, maxIndexEntries));
+}
+
+size_t CompilerCacheArchive::getRequiredSize(uint32_t indexEntriesCount, size_t dataCapacity) {
+    return getDataOffset(indexEntriesCount) + dataCapacity;
+}
+
+size_t CompilerCacheArchive::getRecordSize(size_t binarySize) {
+    return alignUp(sizeof(RecordHeader) + binarySize, dataAlignment);
+}
+
+CompilerCacheArchive::CompilerCacheArchive(void *memory, size_t memorySize, uint32_t indexEntriesCount, size_t dataCapacity)
+    : memory(reinterpret_cast<char *>(memory)), memorySize(memorySize), requestedIndexEntriesCount(indexEntriesCount), requestedDataCapacity(dataCapacity) {
+    UNRECOVERABLE_IF(memorySize < getRequiredSize(indexEntriesCount, dataCapacity));
+    UNRECOVERABLE_IF(!Math::isPow2(indexEntriesCount));
+
+    header = reinterpret_cast<Header *>(this->memory);
+    useLayout(indexEntriesCount, dataCapacity);
+}
+
+void CompilerCacheArchive::useLayout(uint32_t indexEntriesCount, size_t dataCapacity) {
+    this->indexEntriesCount = indexEntriesCount;
+    this->dataCapacity = dataCapacity;
+    index = reinterpret_cast<IndexEntry *>(memory + getIndexOffset());
+    data = memory + getDataOffset(indexEntriesCount);
+}
+
+bool CompilerCacheArchive::isFormatted() const {
+    if (header->magic != archiveMagic || header->version != archiveVersion) {
+        return false;
+    }
+    const auto entriesCount = header->indexEntriesCount;
+    const auto capacity = header->dataCapacity;
+    return Math::isPow2(entriesCount) && entriesCount >= minIndexEntries && entriesCount <= maxIndexEntries &&
+           capacity >= dataAlignment && capacity <= maxDataCapacity &&
+           getRequiredSize(entriesCount, static_cast<size_t>(capacity)) <= memorySize &&
+           header->writeOffset <= capacity &&
+           header->evictOffset <= header->previousLapEnd && header->previousLapEnd <= capacity;
+}
+
+void CompilerCacheArchive::format() {
+    header->magic = 0u;
+    useLayout(requestedIndexEntriesCount, requestedDataCapacity);
+    memset(index, 0, indexEntriesCount * sizeof(IndexEntry));
+
+    header->version = archiveVersion;
+    header->indexEntriesCount = indexEntriesCount;
+    header->dataCapacity = dataCapacity;
+    header->writeOffset = 0u;
+    header->evictOffset = 0u;
+    header->previousLapEnd = 0u;
+    header->usedBytes = 0u;
+    header->usedEntries = 0u;
+    header->removedEntries = 0u;
+    header->magic = archiveMagic;
+}
+
+CompilerCacheArchive::IndexEntry *CompilerCacheArchive::findEntry(const std::string &key, uint64_t keyHash) {
+    const uint32_t mask = indexEntriesCount - 1;
+    for (uint32_t probe = 0; probe < indexEntriesCount; probe++) {
+        auto &entry = index[(keyHash + probe) & mask];
+        if (entry.state == EntryState::empty) {
+            return nullptr;
+        }
+        if (entry.state == EntryState::occupied && entry.keyHash == keyHash &&
+            entry.keyLength == key.size() && 0 == memcmp(entry.key, key.c_str(), key.size())) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CompilerCacheArchive::IndexEntry *CompilerCacheArchive::findEntryAtOffset(uint64_t keyHash, uint64_t dataOffset) {
+    const uint32_t mask = indexEntriesCount - 1;
+    for (uint32_t probe = 0; probe < indexEntriesCount; probe++) {
+        auto &entry = index[(keyHash + probe) & mask];
+        if (entry.state == EntryState::empty) {
+            return nullptr;
+        }
+        if (entry.state == EntryState::occupied && entry.keyHash == keyHash && entry.dataOffset == dataOffset) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CompilerCacheArchive::IndexEntry *CompilerCacheArchive::findSlotForInsert(uint64_t keyHash) {
+    const uint32_t mask = indexEntriesCount - 1;
+    for (uint32_t probe = 0; probe < indexEntriesCount; probe++) {
+        auto &entry = index[(keyHash + probe) & mask];
+        if (entry.state != EntryState::occupied) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void CompilerCacheArchive::removeEntry(IndexEntry &entry) {
+    DEBUG_BREAK_IF(entry.state != EntryState::occupied);
+    entry.state = EntryState::removed;
+    header->usedBytes -= entry.dataSize;
+    header->usedEntries--;
+    header->removedEntries++;
+}
+
+void CompilerCacheArchive::evictPreviousLap(uint64_t rangeEnd) {
+    while (header->evictOffset < header->previousLapEnd && header->evictOffset < rangeEnd) {
+        const uint64_t recordOffset = header->evictOffset;
+        RecordHeader record = {};
+        memcpy_s(&record, sizeof(record), data + recordOffset, sizeof(record));
+        if (record.recordSize == 0u || record.recordSize > header->previousLapEnd - recordOffset) {
+            // damaged log, drop whatever is left of previous lap
+            for (uint32_t i = 0; i < indexEntriesCount; i++) {
+                auto &entry = index[i];
+                if (entry.state == EntryState::occupied && entry.dataOffset >= recordOffset && entry.dataOffset < header->previousLapEnd) {
+                    removeEntry(entry);
+                }
+            }
+            header->evictOffset = header->previousLapEnd;
+            return;
+        }
+
+        // entry may be gone already, e.g. moved to log tail on hit
+        auto entry = findEntryAtOffset(record.keyHash, recordOffset);
+        if (entry) {
+            removeEntry(*entry);
+        }
+        header->evictOffset += record.recordSize;
+    }
+}
+
+void CompilerCacheArchive::rebuildIndex() {
+    std::vector<IndexEntry> liveEntries;
+    liveEntries.reserve(header->usedEntries);
+    for (uint32_t i = 0; i < indexEntriesCount; i++) {
+        if (index[i].state == EntryState::occupied) {
+            liveEntries.push_back(index[i]);
+        }
+    }
+
+    memset(index, 0, indexEntriesCount * sizeof(IndexEntry));
+    for (auto &liveEntry : liveEntries) {
+        auto slot = findSlotForInsert(liveEntry.keyHash);
+        *slot = liveEntry;
+    }
+    header->removedEntries = 0u;
+}
+
+bool CompilerCacheArchive::isAboutToBeOverwritten(const IndexEntry &entry) const {
+    const uint64_t distanceFromWriteOffset = (entry.dataOffset + dataCapacity - header->writeOffset) % dataCapacity;
+    return distanceFromWriteOffset < dataCapacity / 4;
+}
+
+bool CompilerCacheArchive::store(const std::string &key, const char *binary, size_t binarySize) {
+    if (binary == nullptr || binarySize == 0u || key.size() > maxKeyLength) {
+        return false;
+    }
+    if (isFormatted()) {
+        useLayout(header->indexEntriesCount, static_cast<size_t>(header->dataCapacity));
+    } else {
+        format();
+    }
+
+    const uint64_t recordSize = getRecordSize(binarySize);
+    if (recordSize > dataCapacity) {
+        return false;
+    }
+
+    const uint64_t keyHash = Hash::hash(key.c_str(), key.size());
+    if (findEntry(key, keyHash)) {
+        return true;
+    }
+
+    // keep load factor below 3/4, so that probing stays short
+    if ((header->usedEntries + header->removedEntries + 1) * 4 > indexEntriesCount * 3) {
+        rebuildIndex();
+        if ((header->usedEntries + 1) * 4 > indexEntriesCount * 3) {
+            return false;
+        }
+    }
+
+    uint64_t writeOffset = header->writeOffset;
+    if (writeOffset + recordSize > dataCapacity) {
+        // wrap around, current lap becomes the previous one
+        evictPreviousLap(header->previousLapEnd);
+        header->previousLapEnd = writeOffset;
+        header->evictOffset = 0u;
+        writeOffset = 0u;
+    }
+    evictPreviousLap(writeOffset + recordSize);
+
+    RecordHeader record = {keyHash, recordSize};
+    memcpy_s(data + writeOffset, dataCapacity - writeOffset, &record, sizeof(record));
+    memcpy_s(data + writeOffset + sizeof(record), dataCapacity - writeOffset - sizeof(record), binary, binarySize);
+
+    auto slot = findSlotForInsert(keyHash);
+    if (slot->state == EntryState::removed) {
+        header->removedEntries--;
+    }
+    slot->keyHash = keyHash;
+    slot->dataOffset = writeOffset;
+    slot->dataSize = binarySize;
+    slot->keyLength = static_cast<uint32_t>(key.size());
+    memcpy_s(slot->key, sizeof(slot->key), key.c_str(), key.size());
+    slot->state = EntryState::occupied;
+
+    header->usedEntries++;
+    header->usedBytes += binarySize;
+    header->writeOffset = writeOffset + recordSize;
+    return true;
+}
+
+std::unique_ptr<char[]> CompilerCacheArchive::load(const std::string &key, size_t &binarySize) {
+    binarySize = 0u;
+    if (!isFormatted() || key.size() > maxKeyLength) {
+        return nullptr;
+    }
+    useLayout(header->indexEntriesCount, static_cast<size_t>(header->dataCapacity));
+
+    auto entry = findEntry(key, Hash::hash(key.c_str(), key.size()));
+    if (entry == nullptr || entry->dataOffset + getRecordSize(static_cast<size_t>(entry->dataSize)) > dataCapacity) {
+        return nullptr;
+    }
+
+    auto size = static_cast<size_t>(entry->dataSize);
+    auto binary = std::make_unique<char[]>(size);
+    memcpy_s(binary.get(), size, data + entry->dataOffset + sizeof(RecordHeader), size);
+
+    if (isAboutToBeOverwritten(*entry)) {
+        removeEntry(*entry);
+        store(key, binary.get(), size);
+    }
+
+    binarySize = size;
+    return binary;
+}
+
+} // namespace NEO
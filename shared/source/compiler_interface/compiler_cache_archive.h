@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace NEO {
+
+// Single file storage for compiler cache binaries.
+// Layout: fixed header, open addressing hash index and a circular data log.
+// Binaries are appended to the log as records; when the log wraps, records of the previous lap are
+// evicted one by one from an eviction cursor as they get overwritten, so a store only touches the
+// records in the written range.
+// Entries hit shortly before being overwritten are moved to the log tail (approximate LRU).
+// An archive with a valid header is used with its own layout, even if it differs from the requested one.
+// The archive operates on memory provided by the caller (a shared file mapping),
+// cross-process synchronization is the caller's responsibility.
+class CompilerCacheArchive {
+  public:
+    static constexpr uint64_t archiveMagic = 0x31564843524f454eull;
+    static constexpr uint32_t archiveVersion = 2u;
+    static constexpr uint32_t maxKeyLength = 64u;
+    static constexpr uint32_t dataAlignment = 64u;
+    static constexpr uint32_t minIndexEntries = 1024u;
+    static constexpr uint32_t maxIndexEntries = 65536u;
+    static constexpr size_t maxDataCapacity = 1024u * 1024u * 1024u;
+
+    enum class EntryState : uint32_t {
+        empty = 0,
+        occupied = 1,
+        removed = 2
+    };
+
+    struct Header {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t indexEntriesCount;
+        uint64_t dataCapacity;
+        uint64_t writeOffset;
+        uint64_t evictOffset; // first record of previous lap not evicted yet
+        uint64_t previousLapEnd;
+        uint64_t usedBytes;
+        uint32_t usedEntries;
+        uint32_t removedEntries;
+    };
+
+    struct RecordHeader {
+        uint64_t keyHash;
+        uint64_t recordSize;
+    };
+
+    struct IndexEntry {
+        uint64_t keyHash;
+        uint64_t dataOffset;
+        uint64_t dataSize;
+        EntryState state;
+        uint32_t keyLength;
+        char key[maxKeyLength];
+    };
+
+    static uint32_t getIndexEntriesCount(size_t dataCapacity);
+    static size_t getRequiredSize(uint32_t indexEntriesCount, size_t dataCapacity);
+
+    static size_t getRecordSize(size_t binarySize);
+
+    CompilerCacheArchive(void *memory, size_t memorySize, uint32_t indexEntriesCount, size_t dataCapacity);
+
+    bool isFormatted() const;
+    void format();
+
+    bool store(const std::string &key, const char *binary, size_t binarySize);
+    std::unique_ptr<char[]> load(const std::string &key, size_t &binarySize);
+
+    uint32_t getUsedEntries() const { return header->usedEntries; }
+    uint64_t getUsedBytes() const { return header->usedBytes; }
+    uint32_t getIndexEntriesCount() const { return indexEntriesCount; }
+    size_t getDataCapacity() const { return dataCapacity; }
+
+  protected:
+    void useLayout(uint32_t indexEntriesCount, size_t dataCapacity);
+    IndexEntry *findEntry(const std::string &key, uint64_t keyHash);
+    IndexEntry *findEntryAtOffset(uint64_t keyHash, uint64_t dataOffset);
+    IndexEntry *findSlotForInsert(uint64_t keyHash);
+    void removeEntry(IndexEntry &entry);
+    void evictPreviousLap(uint64_t rangeEnd);
+    void rebuildIndex();
+    bool isAboutToBeOverwritten(const IndexEntry &entry) const;
+
+    char *memory = nullptr;
+    const size_t memorySize;
+    Header *header = nullptr;
+    IndexEntry *index = nullptr;
+    char *data = nullptr;
+    const uint32_t requestedIndexEntriesCount;
+    const size_t requestedDataCapacity;
+    uint32_t indexEntriesCount;
+    size_t dataCapacity;
+};
+} // namespace NEO
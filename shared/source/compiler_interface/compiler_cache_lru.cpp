@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_lru.h"
+
+#include "shared/source/helpers/string.h"
+
+namespace NEO {
+
+void CompilerCacheLru::store(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (pBinary == nullptr || binarySize == 0u || binarySize > capacity) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entriesByHash.find(kernelFileHash);
+    if (it != entriesByHash.end()) {
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+
+    evict(binarySize);
+
+    auto binary = std::make_unique<char[]>(binarySize);
+    memcpy_s(binary.get(), binarySize, pBinary, binarySize);
+
+    entries.push_front({kernelFileHash, std::move(binary), binarySize});
+    entriesByHash.emplace(kernelFileHash, entries.begin());
+    usedBytes += binarySize;
+}
+
+std::unique_ptr<char[]> CompilerCacheLru::load(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entriesByHash.find(kernelFileHash);
+    if (it == entriesByHash.end()) {
+        misses++;
+        return nullptr;
+    }
+    hits++;
+
+    entries.splice(entries.begin(), entries, it->second);
+    auto &entry = *it->second;
+
+    auto binary = std::make_unique<char[]>(entry.binarySize);
+    memcpy_s(binary.get(), entry.binarySize, entry.binary.get(), entry.binarySize);
+    cachedBinarySize = entry.binarySize;
+    return binary;
+}
+
+void CompilerCacheLru::evict(size_t bytesRequired) {
+    while (!entries.empty() && usedBytes + bytesRequired > capacity) {
+        auto &leastRecentlyUsed = entries.back();
+        usedBytes -= leastRecentlyUsed.binarySize;
+        entriesByHash.erase(leastRecentlyUsed.kernelFileHash);
+        entries.pop_back();
+    }
+}
+
+size_t CompilerCacheLru::getUsedBytes() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return usedBytes;
+}
+
+size_t CompilerCacheLru::getNumEntries() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+uint64_t CompilerCacheLru::getHits() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return hits;
+}
+
+uint64_t CompilerCacheLru::getMisses() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return misses;
+}
+
+} // namespace NEO
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+
+// Bounded in-process cache of compiled binaries, kept in front of the on-disk compiler cache.
+// Binaries are evicted in least recently used order once capacity (in bytes) is exceeded.
+class CompilerCacheLru {
+  public:
+    explicit CompilerCacheLru(size_t capacity) : capacity(capacity) {}
+
+    void store(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    std::unique_ptr<char[]> load(const std::string &kernelFileHash, size_t &cachedBinarySize);
+
+    size_t getCapacity() const { return capacity; }
+    size_t getUsedBytes() const;
+    size_t getNumEntries() const;
+    uint64_t getHits() const;
+    uint64_t getMisses() const;
+
+  protected:
+    struct Entry {
+        std::string kernelFileHash;
+        std::unique_ptr<char[]> binary;
+        size_t binarySize;
+    };
+    using EntryList = std::list<Entry>;
+
+    void evict(size_t bytesRequired);
+
+    const size_t capacity;
+    size_t usedBytes = 0u;
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+
+    EntryList entries;
+    std::unordered_map<std::string, EntryList::iterator> entriesByHash;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -25,7 +26,10 @@
 
 #include "RelocationInfo.h"
 
+#include <atomic>
 #include <sstream>
+#include <system_error>
+#include <thread>
 #include <unordered_map>
 
 namespace NEO {
@@ -127,6 +131,7 @@ bool LinkerInput::decodeRelocationTable(const void *data, uint32_t numEntries, u
         RelocationInfo relocInfo{};
         relocInfo.offset = relocEntryIt->r_offset;
         relocInfo.symbolName = relocEntryIt->r_symbol;
+        relocInfo.symbolId = internSymbolName(relocInfo.symbolName);
         relocInfo.relocationSegment = SegmentType::instructions;
         switch (relocEntryIt->r_type) {
         default:
@@ -156,6 +161,7 @@ void LinkerInput::addDataRelocationInfo(const RelocationInfo &relocationInfo) {
     this->traits.requiresPatchingOfGlobalVariablesBuffer |= (relocationInfo.relocationSegment == SegmentType::globalVariables);
     this->traits.requiresPatchingOfGlobalConstantsBuffer |= (relocationInfo.relocationSegment == SegmentType::globalConstants);
     this->dataRelocations.push_back(relocationInfo);
+    this->dataRelocations.rbegin()->symbolId = internSymbolName(relocationInfo.symbolName);
 }
 
 void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId) {
@@ -169,10 +175,22 @@ void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uin
     auto &outRelocInfo = textRelocations[instructionsSegmentId];
 
     relocationInfo.relocationSegment = SegmentType::instructions;
+    relocationInfo.symbolId = internSymbolName(relocationInfo.symbolName);
 
     outRelocInfo.push_back(std::move(relocationInfo));
 }
 
+uint32_t LinkerInput::internSymbolName(const std::string &symbolName) {
+    if (symbolName.empty()) {
+        return invalidSymbolId;
+    }
+    auto [it, inserted] = symbolNameToId.try_emplace(symbolName, static_cast<uint32_t>(internedSymbolNames.size()));
+    if (inserted) {
+        internedSymbolNames.push_back(symbolName);
+    }
+    return it->second;
+}
+
 template bool LinkerInput::addRelocation(Elf::Elf<Elf::EI_CLASS_32> &elf, const SectionNameToSegmentIdMap &nameToSegmentId, const typename Elf::Elf<Elf::EI_CLASS_32>::RelocationInfo &reloc);
 template bool LinkerInput::addRelocation(Elf::Elf<Elf::EI_CLASS_64> &elf, const SectionNameToSegmentIdMap &nameToSegmentId, const typename Elf::Elf<Elf::EI_CLASS_64>::RelocationInfo &reloc);
 template <Elf::ElfIdentifierClass numBits>
@@ -321,9 +339,11 @@ LinkingStatus Linker::link(const SegmentInfo &globalVariablesSegInfo, const Segm
     if (!success) {
         return LinkingStatus::error;
     }
+    internRelocatedSymbols();
     patchInstructionsSegments(instructionsSegments, outUnresolvedExternals, kernelDescriptors);
     patchDataSegments(globalVariablesSegInfo, globalConstantsSegInfo, globalVariablesSeg, globalConstantsSeg,
                       outUnresolvedExternals, pDevice, constantsInitData, constantsInitDataSize, variablesInitData, variablesInitDataSize);
+    relocatedSymbolsById.clear();
     removeLocalSymbolsFromRelocatedSymbols();
     resolveImplicitArgs(kernelDescriptors, pDevice);
     resolveBuiltins(pDevice, outUnresolvedExternals, instructionsSegments);
@@ -390,6 +410,57 @@ bool Linker::relocateSymbols(const SegmentInfo &globalVariables, const SegmentIn
     return true;
 }
 
+void Linker::internRelocatedSymbols() {
+    // symbol names are looked up once per distinct symbol instead of once per relocation
+    const auto &internedSymbolNames = data.getInternedSymbolNames();
+    relocatedSymbolsById.assign(internedSymbolNames.size(), {});
+    implicitArgsSymbolId = LinkerInput::invalidSymbolId;
+    for (uint32_t symbolId = 0u; symbolId < internedSymbolNames.size(); symbolId++) {
+        const auto &symbolName = internedSymbolNames[symbolId];
+        if (symbolName == implicitArgsRelocationSymbolName) {
+            implicitArgsSymbolId = symbolId;
+        }
+        if (auto symbolIt = relocatedSymbols.find(symbolName); symbolIt != relocatedSymbols.end()) {
+            relocatedSymbolsById[symbolId] = {symbolIt->second.gpuAddress, true};
+        }
+    }
+}
+
+std::optional<uint64_t> Linker::getRelocatedSymbolAddress(const RelocationInfo &relocation) const {
+    if (relocation.symbolId < relocatedSymbolsById.size()) {
+        const auto &symbol = relocatedSymbolsById[relocation.symbolId];
+        return symbol.relocated ? std::optional<uint64_t>{symbol.gpuAddress} : std::nullopt;
+    }
+    auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+    if (symbolIt == relocatedSymbols.end()) {
+        return std::nullopt;
+    }
+    return symbolIt->second.gpuAddress;
+}
+
+bool Linker::isImplicitArgsRelocation(const RelocationInfo &relocation) const {
+    if (relocation.symbolId < relocatedSymbolsById.size()) {
+        return relocation.symbolId == implicitArgsSymbolId;
+    }
+    return relocation.symbolName == implicitArgsRelocationSymbolName;
+}
+
+uint32_t getLinkingThreadsCount(size_t relocationsCount, size_t segmentsCount) {
+    const auto parallelLinking = debugManager.flags.EnableParallelLinking.get();
+    if (parallelLinking == 0) {
+        return 1u;
+    }
+    if (parallelLinking == -1 && relocationsCount < parallelLinkingMinRelocationsCount) {
+        return 1u;
+    }
+
+    uint32_t threadsCount = std::min(std::max(std::thread::hardware_concurrency(), 1u), maxLinkingThreadsCount);
+    if (debugManager.flags.OverrideLinkingThreadsCount.get() != -1) {
+        threadsCount = static_cast<uint32_t>(debugManager.flags.OverrideLinkingThreadsCount.get());
+    }
+    return static_cast<uint32_t>(std::min<size_t>(std::max(threadsCount, 1u), std::max<size_t>(segmentsCount, 1u)));
+}
+
 uint32_t addressSizeInBytes(LinkerInput::RelocationInfo::Type relocationtype) {
     return (relocationtype == LinkerInput::RelocationInfo::Type::address) ? sizeof(uintptr_t) : sizeof(uint32_t);
 }
@@ -427,33 +498,106 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
 
     auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
+
+    size_t relocationsCount = 0u;
+    for (const auto &relocations : relocationsPerSegment) {
+        relocationsCount += relocations.size();
+    }
+    const auto threadsCount = getLinkingThreadsCount(relocationsCount, relocationsPerSegment.size());
+    if (threadsCount > 1u) {
+        patchInstructionsSegmentsInParallel(instructionsSegments, outUnresolvedExternals, kernelDescriptors, threadsCount);
+        return;
+    }
+
     for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
-        auto &segment = instructionsSegments[segId];
-        for (const auto &relocation : relocationsPerSegment[segId]) {
-            UNRECOVERABLE_IF(nullptr == segment.hostPointer);
-            bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
-            if (invalidRelocation) {
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                DEBUG_BREAK_IF(true);
-                continue;
-            }
+        ImplicitArgsRelocationAddresses implicitArgsRelocationAddresses;
+        patchInstructionsSegment(static_cast<uint32_t>(segId), instructionsSegments[segId], relocationsPerSegment[segId], kernelDescriptors,
+                                 outUnresolvedExternals, implicitArgsRelocationAddresses);
+        appendImplicitArgsRelocationAddresses(static_cast<uint32_t>(segId), implicitArgsRelocationAddresses);
+    }
+}
+
+void Linker::patchInstructionsSegmentsInParallel(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals,
+                                                 const KernelDescriptorsT &kernelDescriptors, uint32_t threadsCount) {
+    struct SegmentPatchingResult {
+        std::vector<UnresolvedExternal> unresolvedExternals;
+        ImplicitArgsRelocationAddresses implicitArgsRelocationAddresses;
+    };
+    auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
+    const size_t segmentsCount = relocationsPerSegment.size();
+    std::vector<SegmentPatchingResult> results(segmentsCount);
+
+    // every segment has its own host copy, so segments are patched independently
+    std::atomic<size_t> nextSegment{0u};
+    auto patchSegments = [&]() {
+        for (size_t segId = nextSegment++; segId < segmentsCount; segId = nextSegment++) {
+            patchInstructionsSegment(static_cast<uint32_t>(segId), instructionsSegments[segId], relocationsPerSegment[segId], kernelDescriptors,
+                                     results[segId].unresolvedExternals, results[segId].implicitArgsRelocationAddresses);
+        }
+    };
 
-            auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
-                *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize;
-            } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(reinterpret_cast<uint32_t *>(relocAddress));
-            } else if (relocation.symbolName.empty()) {
-                uint64_t patchValue = 0;
+    std::vector<std::thread> workers;
+    workers.reserve(threadsCount - 1);
+    for (uint32_t i = 0; i < threadsCount - 1; i++) {
+        try {
+            startLinkingWorker(workers, patchSegments);
+        } catch (const std::system_error &) {
+            // out of threads, segments not taken by started workers are patched by calling thread
+            break;
+        }
+    }
+    patchSegments();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    // merge in segment order, so that output is identical to sequential patching
+    for (size_t segId = 0U; segId < segmentsCount; segId++) {
+        auto &result = results[segId];
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), result.unresolvedExternals.begin(), result.unresolvedExternals.end());
+        appendImplicitArgsRelocationAddresses(static_cast<uint32_t>(segId), result.implicitArgsRelocationAddresses);
+    }
+}
+
+void Linker::startLinkingWorker(std::vector<std::thread> &workers, const std::function<void()> &work) {
+    workers.emplace_back(work);
+}
+
+void Linker::appendImplicitArgsRelocationAddresses(uint32_t segId, const ImplicitArgsRelocationAddresses &implicitArgsRelocationAddresses) {
+    if (implicitArgsRelocationAddresses.empty()) {
+        return;
+    }
+    auto &outRelocationAddresses = pImplicitArgsRelocationAddresses[segId];
+    for (auto relocationAddress : implicitArgsRelocationAddresses) {
+        outRelocationAddresses.push_back(relocationAddress);
+    }
+}
+
+void Linker::patchInstructionsSegment(uint32_t segId, const PatchableSegment &segment, const LinkerInput::Relocations &relocations, const KernelDescriptorsT &kernelDescriptors,
+                                      std::vector<UnresolvedExternal> &outUnresolvedExternals, ImplicitArgsRelocationAddresses &outImplicitArgsRelocationAddresses) const {
+    for (const auto &relocation : relocations) {
+        UNRECOVERABLE_IF(nullptr == segment.hostPointer);
+        bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
+        if (invalidRelocation) {
+            outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
+            DEBUG_BREAK_IF(true);
+            continue;
+        }
+
+        auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
+        if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
+            *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize;
+        } else if (isImplicitArgsRelocation(relocation)) {
+            outImplicitArgsRelocationAddresses.push_back(reinterpret_cast<uint32_t *>(relocAddress));
+        } else if (relocation.symbolName.empty()) {
+            uint64_t patchValue = 0;
+            patchAddress(relocAddress, patchValue, relocation);
+        } else {
+            if (auto symbolAddress = getRelocatedSymbolAddress(relocation); symbolAddress.has_value()) {
+                uint64_t patchValue = *symbolAddress + relocation.addend;
                 patchAddress(relocAddress, patchValue, relocation);
             } else {
-                auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-                if (symbolIt != relocatedSymbols.end()) {
-                    uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
-                    patchAddress(relocAddress, patchValue, relocation);
-                } else {
-                    outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                }
+                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
             }
         }
     }
@@ -470,12 +614,12 @@ void Linker::patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const
     bool isAnyRelocationPerformed = false;
 
     for (const auto &relocation : data.getDataRelocations()) {
-        auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-        if (symbolIt == relocatedSymbols.end()) {
+        auto symbolAddress = getRelocatedSymbolAddress(relocation);
+        if (false == symbolAddress.has_value()) {
             outUnresolvedExternals.push_back(UnresolvedExternal{relocation});
             continue;
         }
-        uint64_t srcGpuAddressAs64Bit = symbolIt->second.gpuAddress;
+        uint64_t srcGpuAddressAs64Bit = *symbolAddress;
 
         ArrayRef<uint8_t> dst{};
         const void *initData = nullptr;
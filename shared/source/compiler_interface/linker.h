@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,11 +7,14 @@
 
 #pragma once
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <optional>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -85,6 +88,8 @@ struct LinkerInput {
     };
     static_assert(sizeof(Traits) == sizeof(Traits::packed), "");
 
+    static constexpr uint32_t invalidSymbolId = std::numeric_limits<uint32_t>::max();
+
     struct RelocationInfo {
         enum class Type : uint32_t {
             unknown,
@@ -100,12 +105,14 @@ struct LinkerInput {
         Type type = Type::unknown;
         SegmentType relocationSegment = SegmentType::unknown;
         int64_t addend = 0U;
+        uint32_t symbolId = invalidSymbolId; // symbolName interned by LinkerInput, see internSymbolName()
     };
 
     using SectionNameToSegmentIdMap = std::unordered_map<std::string, uint32_t>;
     using Relocations = std::vector<RelocationInfo>;
     using SymbolMap = std::unordered_map<std::string, SymbolInfo>;
     using RelocationsPerInstSegment = std::vector<Relocations>;
+    using SymbolNameToIdMap = std::unordered_map<std::string, uint32_t>;
 
     virtual ~LinkerInput() = default;
 
@@ -117,6 +124,7 @@ struct LinkerInput {
     void addDataRelocationInfo(const RelocationInfo &relocationInfo);
 
     void addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId);
+    uint32_t internSymbolName(const std::string &symbolName);
 
     template <Elf::ElfIdentifierClass numBits>
     void decodeElfSymbolTableAndRelocations(Elf::Elf<numBits> &elf, const SectionNameToSegmentIdMap &nameToSegmentId);
@@ -157,6 +165,10 @@ struct LinkerInput {
         return dataRelocations;
     }
 
+    const std::vector<std::string> &getInternedSymbolNames() const {
+        return internedSymbolNames;
+    }
+
     void setPointerSize(Traits::PointerSize pointerSize) {
         traits.pointerSize = pointerSize;
     }
@@ -181,6 +193,8 @@ struct LinkerInput {
     std::vector<std::pair<std::string, SymbolInfo>> extFuncSymbols;
     Relocations dataRelocations;
     RelocationsPerInstSegment textRelocations;
+    SymbolNameToIdMap symbolNameToId;
+    std::vector<std::string> internedSymbolNames;
     std::vector<ExternalFunctionUsageKernel> kernelDependencies;
     std::vector<ExternalFunctionUsageExtFunc> extFunDependencies;
     int32_t exportedFunctionsSegmentId = -1;
@@ -248,7 +262,18 @@ struct Linker {
 
     bool relocateSymbols(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions, const SegmentInfo &globalStrings, const PatchableSegments &instructionsSegments, size_t globalConstantsInitDataSize, size_t globalVariablesInitDataSize);
 
+    using ImplicitArgsRelocationAddresses = StackVec<uint32_t *, 2>;
+
+    void internRelocatedSymbols();
+    std::optional<uint64_t> getRelocatedSymbolAddress(const RelocationInfo &relocation) const;
+    bool isImplicitArgsRelocation(const RelocationInfo &relocation) const;
+
     void patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors);
+    void patchInstructionsSegmentsInParallel(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors, uint32_t threadsCount);
+    MOCKABLE_VIRTUAL void startLinkingWorker(std::vector<std::thread> &workers, const std::function<void()> &work);
+    void patchInstructionsSegment(uint32_t segId, const PatchableSegment &segment, const LinkerInput::Relocations &relocations, const KernelDescriptorsT &kernelDescriptors,
+                                  std::vector<UnresolvedExternal> &outUnresolvedExternals, ImplicitArgsRelocationAddresses &outImplicitArgsRelocationAddresses) const;
+    void appendImplicitArgsRelocationAddresses(uint32_t segId, const ImplicitArgsRelocationAddresses &implicitArgsRelocationAddresses);
 
     void patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo,
                            GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
@@ -262,9 +287,20 @@ struct Linker {
     template <typename PatchSizeT>
     void patchIncrement(void *dstAllocation, size_t relocationOffset, const void *initData, uint64_t incrementValue);
 
-    std::unordered_map<uint32_t /*ISA segment id*/, StackVec<uint32_t *, 2> /*implicit args relocation address to patch*/> pImplicitArgsRelocationAddresses;
+    std::unordered_map<uint32_t /*ISA segment id*/, ImplicitArgsRelocationAddresses /*implicit args relocation address to patch*/> pImplicitArgsRelocationAddresses;
+
+    struct InternedSymbol {
+        uint64_t gpuAddress = 0u;
+        bool relocated = false;
+    };
+    std::vector<InternedSymbol> relocatedSymbolsById; // indexed with LinkerInput symbol ids, valid only while relocations are applied
+    uint32_t implicitArgsSymbolId = LinkerInput::invalidSymbolId;
 };
 
+inline constexpr size_t parallelLinkingMinRelocationsCount = 16384u;
+inline constexpr uint32_t maxLinkingThreadsCount = 8u;
+uint32_t getLinkingThreadsCount(size_t relocationsCount, size_t segmentsCount);
+
 std::string constructLinkerErrorMessage(const Linker::UnresolvedExternals &unresolvedExternals, const std::vector<std::string> &instructionsSegmentsNames);
 std::string constructRelocationsDebugMessage(const Linker::RelocatedSymbolsMap &relocatedSymbols);
 
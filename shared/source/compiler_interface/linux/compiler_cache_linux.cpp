@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_archive.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/file_io.h"
@@ -119,13 +120,16 @@ bool CompilerCache::renameTempFileBinaryToProperName(const std::string &oldName,
     return true;
 }
 
-void unlockFileAndClose(int fd) {
+void unlockFile(int fd) {
     int lockErr = NEO::SysCalls::flock(fd, LOCK_UN);
 
     if (lockErr < 0) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: unlock file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
     }
+}
 
+void unlockFileAndClose(int fd) {
+    unlockFile(fd);
     NEO::SysCalls::close(fd);
 }
 
@@ -216,11 +220,113 @@ class HandleGuard {
     int fd = -1;
 };
 
-bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+bool CompilerCache::openArchive() {
+    if (archive) {
+        return true;
+    }
+
+    const size_t dataCapacity = std::min(config.cacheSize, CompilerCacheArchive::maxDataCapacity);
+    const uint32_t indexEntriesCount = CompilerCacheArchive::getIndexEntriesCount(dataCapacity);
+    const size_t archiveSize = CompilerCacheArchive::getRequiredSize(indexEntriesCount, dataCapacity);
+    const std::string archivePath = joinPath(config.cacheDir, getArchiveFileName());
+
+    int fd = NEO::SysCalls::openWithMode(archivePath.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
+    if (fd < 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Open archive file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        return false;
+    }
+
+    struct stat statBuffer = {};
+    if (NEO::SysCalls::fstat(fd, &statBuffer) != 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Stat archive file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        NEO::SysCalls::close(fd);
+        return false;
+    }
+
+    if (static_cast<size_t>(statBuffer.st_size) < archiveSize) {
+        // extend to full size without writing data, file stays sparse until binaries are stored
+        const char lastByte = 0;
+        if (NEO::SysCalls::pwrite(fd, &lastByte, sizeof(lastByte), static_cast<off_t>(archiveSize - sizeof(lastByte))) < 0) {
+            NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Resize archive file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+            NEO::SysCalls::close(fd);
+            return false;
+        }
+    }
+
+    // archive may have been formatted by a process with larger cache size, map whole file so its layout can be used
+    const size_t mappingSize = std::max(static_cast<size_t>(statBuffer.st_size), archiveSize);
+    void *mapping = NEO::SysCalls::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED || mapping == nullptr) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Mapping archive file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        NEO::SysCalls::close(fd);
+        return false;
+    }
+
+    archiveMapping = mapping;
+    archiveMappingSize = mappingSize;
+    std::get<int>(archiveHandle) = fd;
+    archive = std::make_unique<CompilerCacheArchive>(mapping, mappingSize, indexEntriesCount, dataCapacity);
+    return true;
+}
+
+void CompilerCache::closeArchive() {
+    archive.reset();
+    if (archiveMapping) {
+        NEO::SysCalls::munmap(archiveMapping, archiveMappingSize);
+        archiveMapping = nullptr;
+        archiveMappingSize = 0u;
+    }
+    if (std::get<int>(archiveHandle) >= 0) {
+        NEO::SysCalls::close(std::get<int>(archiveHandle));
+        std::get<int>(archiveHandle) = -1;
+    }
+}
+
+bool CompilerCache::cacheBinaryInArchive(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    std::unique_lock<std::mutex> lock(cacheAccessMtx);
+    if (!openArchive()) {
+        return false;
+    }
+
+    const int fd = std::get<int>(archiveHandle);
+    if (NEO::SysCalls::flock(fd, LOCK_EX) < 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Lock archive file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        return false;
+    }
+
+    const bool stored = archive->store(kernelFileHash, pBinary, binarySize);
+    unlockFile(fd);
+    return stored;
+}
+
+std::unique_ptr<char[]> CompilerCache::loadCachedBinaryFromArchive(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    cachedBinarySize = 0u;
+    std::unique_lock<std::mutex> lock(cacheAccessMtx);
+    if (!openArchive()) {
+        return nullptr;
+    }
+
+    // exclusive lock, as hit may move the entry to the log tail
+    const int fd = std::get<int>(archiveHandle);
+    if (NEO::SysCalls::flock(fd, LOCK_EX) < 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Lock archive file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        return nullptr;
+    }
+
+    auto binary = archive->load(kernelFileHash, cachedBinarySize);
+    unlockFile(fd);
+    return binary;
+}
+
+bool CompilerCache::cacheBinaryOnDisk(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
     if (pBinary == nullptr || binarySize == 0 || binarySize > config.cacheSize) {
         return false;
     }
 
+    if (config.useArchive) {
+        return cacheBinaryInArchive(kernelFileHash, pBinary, binarySize);
+    }
+
     std::unique_lock<std::mutex> lock(cacheAccessMtx);
     constexpr std::string_view configFileName = "config.file";
 
@@ -277,7 +383,11 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
     return true;
 }
 
-std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+std::unique_ptr<char[]> CompilerCache::loadCachedBinaryFromDisk(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    if (config.useArchive) {
+        return loadCachedBinaryFromArchive(kernelFileHash, cachedBinarySize);
+    }
+
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
 
     return loadDataFromFile(filePath.c_str(), cachedBinarySize);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -251,7 +251,7 @@ void writeDirSizeToConfigFile(void *hConfigFile, size_t directorySize) {
     }
 }
 
-bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+bool CompilerCache::cacheBinaryOnDisk(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
     if (pBinary == nullptr || binarySize == 0 || binarySize > config.cacheSize) {
         return false;
     }
@@ -315,7 +315,22 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
     return true;
 }
 
-std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+bool CompilerCache::openArchive() {
+    return false;
+}
+
+void CompilerCache::closeArchive() {}
+
+bool CompilerCache::cacheBinaryInArchive(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    return false;
+}
+
+std::unique_ptr<char[]> CompilerCache::loadCachedBinaryFromArchive(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    cachedBinarySize = 0u;
+    return nullptr;
+}
+
+std::unique_ptr<char[]> CompilerCache::loadCachedBinaryFromDisk(const std::string &kernelFileHash, size_t &cachedBinarySize) {
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
     return loadDataFromFile(filePath.c_str(), cachedBinarySize);
 }
@@ -281,6 +281,7 @@ DECLARE_DEBUG_VARIABLE(bool, PrintExecutionBuffer, false, "print execution buffe
 DECLARE_DEBUG_VARIABLE(bool, PrintBOsForSubmit, false, "print all BOs passed to submission")
 DECLARE_DEBUG_VARIABLE(bool, PrintDebugSettings, false, "Dump all debug variables settings to text file. Print to stdout if value is different than default.")
 DECLARE_DEBUG_VARIABLE(bool, PrintDebugMessages, false, "when enabled, some debug messages will be propagated to console")
+DECLARE_DEBUG_VARIABLE(bool, PrintCompilerCacheInMemoryStatistics, false, "Print hit and miss counters of in-process compiler cache when compiler cache is destroyed")
 DECLARE_DEBUG_VARIABLE(bool, PrintXeLogs, false, "when enabled, xe logs will be propagated to console")
 DECLARE_DEBUG_VARIABLE(bool, DumpZEBin, false, "Enables dumping zebin (elf) to a binary file (.elf extension)")
 DECLARE_DEBUG_VARIABLE(bool, DumpKernels, false, "Enables dumping kernels' program source code to text files and program from binary to bin file")
@@ -307,6 +308,7 @@ DECLARE_DEBUG_VARIABLE(bool, PrintGlobalTimestampInNs, false, "prints host and d
 DECLARE_DEBUG_VARIABLE(bool, WddmResidencyLogger, false, "gather Wddm residency statistics to file")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOCreateDestroyResult, false, "tracks the result of creation and destruction of BOs")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOBindingResult, false, "tracks the result of binding and unbinding of BOs")
+DECLARE_DEBUG_VARIABLE(bool, PrintUsmAllocationsCacheStatistics, false, "Print hits, misses, hit rate and held bytes of USM allocations reuse caches when SVM manager is destroyed")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOPrefetchingResult, false, "tracks the result of prefetching BOs")
 DECLARE_DEBUG_VARIABLE(bool, PrintTagAllocationAddress, false, "Print tag allocation address for each engine")
 DECLARE_DEBUG_VARIABLE(bool, ProvideVerboseImplicitFlush, false, "provides verbose messages about implicit flush mechanism")
@@ -527,6 +529,38 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Exper
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockWaitlistSizeThreshold, -1, "If less than given value, driver will wait for Waitlist on host, instead of sending appendBarrier. If 0, always use barrier.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally enable attaching to tiles (subdevices).")
+DECLARE_DEBUG_VARIABLE(int32_t, ForceHeapAllocatorMode, -1, "-1: default, 0: two sided heap allocator, 1: size class binned heap allocator (TLSF-style free lists)")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCompilerCacheArchive, -1, "-1: default, 0: disable, 1: enable. Store compiler cache binaries in a single memory mapped archive file instead of one file per binary")
+DECLARE_DEBUG_VARIABLE(int64_t, CompilerCacheInMemorySize, -1, "-1: default (disabled), 0: disabled, >0: capacity in bytes of in-process cache of compiled binaries kept in front of compiler cache")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelZeInfoDecoding, -1, "-1: default (parallel for modules with at least 64 kernels), 0: disable, 1: enable. Decode zeInfo kernel entries on multiple threads")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideZeInfoDecodingThreadsCount, -1, "-1: default (number of hardware threads, at most 8), >0: number of threads used for parallel zeInfo decoding")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyKernelInitialization, -1, "-1: default (disabled), 0: disable, 1: enable. Initialize kernel immutable data and upload ISA of user modules on first kernel creation instead of at module creation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIsaPooling, -1, "-1: default (disabled), 0: disable, 1: enable. Sub-allocate ISA of small modules from device-wide pools and share ISA of modules with identical, relocation-free kernel binaries")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelLinking, -1, "-1: default (enabled for binaries with at least 16384 ISA relocations), 0: disable, 1: enable. Apply relocations of different ISA segments on multiple threads")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideLinkingThreadsCount, -1, "-1: default (number of hardware threads, at most 8), >0: number of threads used for parallel linking")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBatchedVmBind, -1, "-1: default (disabled), 0: disable, 1: enable. Collect unbound buffer objects of allocations made resident within OS context and bind them as one batch signaling a single user fence")
+DECLARE_DEBUG_VARIABLE(int64_t, ExperimentalUsmAllocationsCacheMaxBytes, -1, "-1: default (no limit), >=0: byte budget of each USM allocations reuse cache, least recently freed allocations are released when exceeded")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalUsmAllocationsCacheMaxAge, -1, "-1: default (disabled), >0: time in milliseconds after which allocations unused in USM allocations reuse cache are released by background thread")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUsmAllocationPoolsManager, -1, "-1: default (disabled), 0: disable, 1: enable. Sub-allocate small host, device and shared USM allocations from pools grouped in size tiers, added on demand when context pool is exhausted")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmAllocationPoolsIdleTime, -1, "-1: default (1000), >=0: time in milliseconds after which empty pools of USM allocation pools manager are released")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLockFreeTagAllocator, -1, "-1: default (disabled), 0: disable, 1: enable. Tag allocators recycle free timestamp and perf counter tags through lock-free stack instead of locked free and used lists")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBatchedGemCloseWorker, -1, "-1: default (disabled), 0: disable, 1: enable. Gem close worker takes buffer objects from lock-free list and closes them in batches")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseWorkerBatchSize, -1, "-1: default (64), >0: number of pending buffer objects which wakes batched gem close worker before batch timeout")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseWorkerMaxPendingBufferObjects, -1, "-1: default (16384), >0: number of pending buffer objects above which batched gem close worker closes them in calling thread")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePredictiveUsmPrefetch, -1, "-1: default (disabled), 0: disabled, 1: shared USM allocations used by appended kernels are prefetched to device on command list submission")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableRangeGranularUsmMigration, -1, "-1: default (disabled), 0: disabled, 1: shared allocations migrated by page fault manager are tracked in ranges, only ranges touched by CPU are transferred")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmMigrationRangeSize, -1, "-1: default (2MB), >0: size in bytes of range tracked by page fault manager when EnableRangeGranularUsmMigration is set, aligned up to page size")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGpuLocalHostAllocationPlacement, -1, "-1: default, 0: disabled, 1: enabled - prefer NUMA node of the device (from sysfs) for host allocations, staging and command buffers, requires EnableHostAllocationMemPolicy, no effect with upstream i915 and xe")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideHostAllocationNumaNode, -1, "-1: default, >=0: NUMA node preferred for host allocations, staging and command buffers, overrides node read from sysfs")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCommandListResidencySetCache, -1, "-1: default (disabled), 0: disabled, 1: residency of closed command lists is cached between executions and merged once per submission")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSubmissionStateCache, -1, "-1: default (disabled), 0: disabled, 1: state tracking results are reused when the same command lists are executed repeatedly on a queue with no other submissions in between")
+DECLARE_DEBUG_VARIABLE(int32_t, WaitPolicy, -1, "-1: default (fixed), 0: fixed - pause loop, umwait and yield, 1: adaptive - spin, umwait and sleep phases selected from learned completion latency of CSR")
+DECLARE_DEBUG_VARIABLE(int32_t, AdaptiveWaitSpinTime, -1, "-1: default (10), >=0: time in microseconds of busy polling before adaptive wait escalates to umwait")
+DECLARE_DEBUG_VARIABLE(int32_t, AdaptiveWaitSleepTime, -1, "-1: default (100), >=0: time in microseconds of single sleep in adaptive wait")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventCompletionMonitor, -1, "-1: default (disabled), 0: disabled, 1: event host synchronization sleeps until a driver thread polling all waited events signals completion")
+DECLARE_DEBUG_VARIABLE(int32_t, EventCompletionMonitorPollPeriod, -1, "-1: default (50), >0: time in microseconds between checks of waited events by event completion monitor thread")
+DECLARE_DEBUG_VARIABLE(int32_t, ReleaseCsrOwnershipBeforeImmediateSynchronize, -1, "-1: default (disabled), 0: disabled, 1: synchronous immediate command lists release CSR ownership after submission, before waiting for its completion")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableResidencyShardLocking, -1, "-1: default (disabled), 0: disable, 1: enable. Bind residency handler locks only the shard of VM it changes instead of a single lock, evictable allocations already bound within VM are made resident without locking")
 
 /*DRIVER TOGGLES*/
 DECLARE_DEBUG_VARIABLE(bool, UseMaxSimdSizeToDeduceMaxWorkgroupSize, false, "With this flag on, max workgroup size is deduced using SIMD32 instead of SIMD8, this causes the max wkg size to be 4 times bigger")
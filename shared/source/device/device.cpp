@@ -26,6 +26,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/os_time.h"
+#include "shared/source/program/isa_pool_allocator.h"
 #include "shared/source/program/sync_buffer_handler.h"
 #include "shared/source/utilities/software_tags_manager.h"
 
@@ -40,6 +41,7 @@ Device::Device(ExecutionEnvironment *executionEnvironment, const uint32_t rootDe
     : executionEnvironment(executionEnvironment), rootDeviceIndex(rootDeviceIndex) {
     this->executionEnvironment->incRefInternal();
     this->executionEnvironment->rootDeviceEnvironments[rootDeviceIndex]->setDummyBlitProperties(rootDeviceIndex);
+    this->isaPoolAllocator = std::make_unique<ISAPoolAllocator>(this);
 
     if (debugManager.flags.NumberOfRegularContextsPerEngine.get() > 1) {
         this->numberOfRegularContextsPerEngine = static_cast<uint32_t>(debugManager.flags.NumberOfRegularContextsPerEngine.get());
@@ -68,6 +70,7 @@ Device::~Device() {
     subdevices.clear();
 
     syncBufferHandler.reset();
+    isaPoolAllocator->releasePools();
     commandStreamReceivers.clear();
     executionEnvironment->memoryManager->waitForDeletions();
 
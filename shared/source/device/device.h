@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@ class ExecutionEnvironment;
 class Debugger;
 class GmmClientContext;
 class GmmHelper;
+class ISAPoolAllocator;
 class SyncBufferHandler;
 enum class EngineGroupType : uint32_t;
 class DebuggerL0;
@@ -144,6 +145,7 @@ class Device : public ReferenceTrackedObject<Device> {
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface() const;
     BuiltIns *getBuiltIns() const;
     void allocateSyncBufferHandler();
+    ISAPoolAllocator &getIsaPoolAllocator() const { return *isaPoolAllocator; }
 
     uint32_t getRootDeviceIndex() const {
         return this->rootDeviceIndex;
@@ -234,6 +236,7 @@ class Device : public ReferenceTrackedObject<Device> {
     DeviceInfo deviceInfo = {};
 
     std::unique_ptr<PerformanceCounters> performanceCounters;
+    std::unique_ptr<ISAPoolAllocator> isaPoolAllocator;
     std::vector<std::unique_ptr<CommandStreamReceiver>> commandStreamReceivers;
     EnginesT allEngines;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include <cstring>
+
 namespace NEO {
 
 namespace Yaml {
@@ -21,6 +23,38 @@ std::string constructYamlError(size_t lineNumber, const char *lineBeg, const cha
     return ret;
 }
 
+namespace {
+constexpr uint64_t lowBits = 0x0101010101010101ULL;
+constexpr uint64_t highBits = 0x8080808080808080ULL;
+
+// sets the high bit of every byte equal to c, exact (no false positives from carries)
+inline uint64_t matchBytes(uint64_t word, char c) {
+    const uint64_t xored = word ^ (lowBits * static_cast<uint8_t>(c));
+    const uint64_t nonZero = ((xored & ~highBits) + ~highBits) | xored;
+    return ~nonZero & highBits;
+}
+
+// mask has at most the high bit of each byte set, so summing bytes by multiplication cannot overflow
+inline size_t countMatches(uint64_t mask) {
+    return static_cast<size_t>(((mask >> 7) * lowBits) >> 56);
+}
+} // namespace
+
+size_t countNewLines(ConstStringRef text) {
+    size_t newLines = 0U;
+    const char *pos = text.begin();
+    const char *end = text.end();
+    for (; end - pos >= static_cast<ptrdiff_t>(sizeof(uint64_t)); pos += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, pos, sizeof(word));
+        newLines += countMatches(matchBytes(word, '\n'));
+    }
+    for (; pos < end; ++pos) {
+        newLines += ('\n' == *pos) ? 1U : 0U;
+    }
+    return newLines;
+}
+
 inline Node &addNode(NodesCache &outNodes, Node &parent) {
     UNRECOVERABLE_IF(outNodes.size() >= outNodes.capacity()); // resize must not grow
     parent.firstChildId = static_cast<NodeId>(outNodes.size());
@@ -151,16 +185,26 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         return true;
     }
 
+    // lines are sized exactly up front, tokens are extrapolated from the lines count
+    const auto linesCount = countNewLines(text) + 1U;
+    outLines.reserve(outLines.size() + linesCount);
+    outTokens.reserve(outTokens.size() + linesCount * estimatedTokensPerLine);
+
     TokenizerContext context{text};
     context.isParsingIdent = true;
 
     while (context.pos < context.end) {
         reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
         switch (context.pos[0]) {
-        case ' ':
-            context.lineIndent += context.isParsingIdent ? 1 : 0;
-            ++context.pos;
+        case ' ': {
+            auto spacesEnd = context.pos + 1;
+            while ((spacesEnd < context.end) && (' ' == spacesEnd[0])) {
+                ++spacesEnd;
+            }
+            context.lineIndent += context.isParsingIdent ? static_cast<uint32_t>(spacesEnd - context.pos) : 0U;
+            context.pos = spacesEnd;
             break;
+        }
         case '\t':
             if (context.isParsingIdent) {
                 context.lineIndent += 4U;
@@ -175,13 +219,8 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '#': {
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::singleCharacter));
-            auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
-            }
+            auto commentIt = static_cast<const char *>(memchr(context.pos + 1, '\n', context.end - (context.pos + 1)));
+            commentIt = (nullptr != commentIt) ? commentIt : context.end;
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::comment));
             }
@@ -349,7 +388,26 @@ bool isEmptyVector(const Token &token, size_t lineId, std::string &outError) {
     return true;
 }
 
+size_t getMaxNodesCount(const LinesCache &lines) {
+    size_t maxNodesCount = 1U; // root
+    for (const auto &line : lines) {
+        if (isUnused(line.lineType)) {
+            continue;
+        }
+        ++maxNodesCount;
+        if ((Line::LineType::listEntry == line.lineType) && line.traits.hasDictionaryEntry) {
+            ++maxNodesCount; // inlined dictionary entry split out by finalizeNode
+        }
+        if (line.traits.hasInlineDataMarkers) {
+            maxNodesCount += (line.last - line.first) / 2U;
+        }
+    }
+    return maxNodesCount;
+}
+
 bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning) {
+    outNodes.reserve(outNodes.size() + getMaxNodesCount(lines));
+
     StackVec<NodeId, 64> nesting;
     size_t lineId = 0U;
     size_t lastUsedLine = 0u;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -284,6 +284,12 @@ inline bool reserveBasedOnEstimates(T &container, It beg, It end, It pos) {
 using TokensCache = StackVec<Token, 2048>;
 using LinesCache = StackVec<Line, 512>;
 
+// typical zeInfo line is "key: value\n"
+constexpr size_t estimatedTokensPerLine = 4U;
+
+// Counts new line characters, scanning 8 bytes at a time
+size_t countNewLines(ConstStringRef text);
+
 std::string constructYamlError(size_t lineNumber, const char *lineBeg, const char *parsePos, const char *reason = nullptr);
 
 bool isValidInlineCollectionFormat(const char *context, const char *contextEnd);
@@ -326,6 +332,7 @@ constexpr bool isUnused(Line::LineType lineType) {
     }
 }
 
+size_t getMaxNodesCount(const LinesCache &lines);
 bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning);
 
 inline const Node *findChildByKey(const Node &parent, const NodesCache &allNodes, const TokensCache &allTokens, const ConstStringRef key) {
@@ -20,6 +20,10 @@
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/const_stringref.h"
 
+#include <atomic>
+#include <system_error>
+#include <thread>
+
 namespace NEO::Zebin::ZeInfo {
 
 template <typename ContainerT>
@@ -488,11 +492,37 @@ DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, co
     return DecodeError::success;
 }
 
+uint32_t getZeInfoKernelsDecodingThreadsCount(size_t kernelsCount) {
+    const auto parallelDecoding = debugManager.flags.EnableParallelZeInfoDecoding.get();
+    if (parallelDecoding == 0) {
+        return 1u;
+    }
+    if (parallelDecoding == -1 && kernelsCount < parallelDecodingMinKernelsCount) {
+        return 1u;
+    }
+
+    uint32_t threadsCount = std::min(std::max(std::thread::hardware_concurrency(), 1u), maxZeInfoDecodingThreadsCount);
+    if (debugManager.flags.OverrideZeInfoDecodingThreadsCount.get() != -1) {
+        threadsCount = static_cast<uint32_t>(debugManager.flags.OverrideZeInfoDecodingThreadsCount.get());
+    }
+    return static_cast<uint32_t>(std::min<size_t>(std::max(threadsCount, 1u), std::max<size_t>(kernelsCount, 1u)));
+}
+
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion) {
     UNRECOVERABLE_IF(zeInfoSections.kernels.size() != 1U);
+    std::vector<const Yaml::Node *> kernelNodes;
     for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
+        kernelNodes.push_back(&kernelNd);
+    }
+
+    const auto threadsCount = getZeInfoKernelsDecodingThreadsCount(kernelNodes.size());
+    if (threadsCount > 1u) {
+        return decodeZeInfoKernelsInParallel(dst, parser, kernelNodes, threadsCount, outErrReason, outWarning, srcZeInfoVersion);
+    }
+
+    for (const auto kernelNd : kernelNodes) {
         auto kernelInfo = std::make_unique<KernelInfo>();
-        auto zeInfoErr = decodeZeInfoKernelEntry(kernelInfo->kernelDescriptor, parser, kernelNd, dst.grfSize, dst.minScratchSpaceSize, outErrReason, outWarning, srcZeInfoVersion);
+        auto zeInfoErr = decodeZeInfoKernelEntry(kernelInfo->kernelDescriptor, parser, *kernelNd, dst.grfSize, dst.minScratchSpaceSize, outErrReason, outWarning, srcZeInfoVersion);
         if (DecodeError::success != zeInfoErr) {
             return zeInfoErr;
         }
@@ -505,6 +535,68 @@ DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, cons
     return DecodeError::success;
 }
 
+DecodeError decodeZeInfoKernelsInParallel(ProgramInfo &dst, Yaml::YamlParser &parser, const std::vector<const Yaml::Node *> &kernelNodes, uint32_t threadsCount,
+                                          std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion) {
+    struct KernelDecodingResult {
+        std::unique_ptr<KernelInfo> kernelInfo;
+        std::string errReason;
+        std::string warning;
+        DecodeError error = DecodeError::success;
+    };
+    const size_t kernelsCount = kernelNodes.size();
+    std::vector<KernelDecodingResult> results(kernelsCount);
+
+    // kernels are handed out in increasing order, so every kernel preceding the first failing one is always decoded
+    std::atomic<size_t> nextKernel{0u};
+    std::atomic<size_t> firstFailedKernel{kernelsCount};
+    auto decodeKernels = [&]() {
+        for (size_t kernelId = nextKernel++; kernelId < kernelsCount; kernelId = nextKernel++) {
+            if (kernelId > firstFailedKernel.load()) {
+                break;
+            }
+            auto &result = results[kernelId];
+            result.kernelInfo = std::make_unique<KernelInfo>();
+            result.error = decodeZeInfoKernelEntry(result.kernelInfo->kernelDescriptor, parser, *kernelNodes[kernelId], dst.grfSize, dst.minScratchSpaceSize,
+                                                   result.errReason, result.warning, srcZeInfoVersion);
+            if (DecodeError::success != result.error) {
+                auto failedKernel = firstFailedKernel.load();
+                while (kernelId < failedKernel && !firstFailedKernel.compare_exchange_weak(failedKernel, kernelId)) {
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadsCount - 1);
+    for (uint32_t i = 0; i < threadsCount - 1; i++) {
+        try {
+            workers.emplace_back(decodeKernels);
+        } catch (const std::system_error &) {
+            // out of threads, kernels not taken by started workers are decoded by calling thread
+            break;
+        }
+    }
+    decodeKernels();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    // merge in kernel order, so that output is identical to sequential decoding
+    dst.kernelInfos.reserve(dst.kernelInfos.size() + kernelsCount);
+    for (auto &result : results) {
+        outWarning.append(result.warning);
+        if (DecodeError::success != result.error) {
+            outErrReason.append(result.errReason);
+            return result.error;
+        }
+        if (result.kernelInfo->kernelDescriptor.kernelMetadata.kernelName == Zebin::Elf::SectionNames::externalFunctions) {
+            dst.functionPointerWithIndirectAccessExists |= result.kernelInfo->kernelDescriptor.kernelAttributes.hasIndirectStatelessAccess;
+        }
+        dst.kernelInfos.push_back(result.kernelInfo.release());
+    }
+    return DecodeError::success;
+}
+
 DecodeError decodeZeInfoKernelEntry(NEO::KernelDescriptor &dst, NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, uint32_t grfSize, uint32_t minScratchSpaceSize, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion) {
     ZeInfoKernelSections zeInfokernelSections;
     extractZeInfoKernelSections(yamlParser, kernelNd, zeInfokernelSections, ".ze_info", outWarning);
@@ -71,7 +71,13 @@ DecodeError decodeZeInfoGlobalHostAccessTable(ProgramInfo &dst, Yaml::YamlParser
 
 DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning);
 
+inline constexpr size_t parallelDecodingMinKernelsCount = 64u;
+inline constexpr uint32_t maxZeInfoDecodingThreadsCount = 8u;
+uint32_t getZeInfoKernelsDecodingThreadsCount(size_t kernelsCount);
+
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion);
+DecodeError decodeZeInfoKernelsInParallel(ProgramInfo &dst, Yaml::YamlParser &parser, const std::vector<const Yaml::Node *> &kernelNodes, uint32_t threadsCount,
+                                          std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion);
 DecodeError decodeZeInfoKernelEntry(KernelDescriptor &dst, Yaml::YamlParser &yamlParser, const Yaml::Node &kernelNd, uint32_t grfSize, uint32_t minScratchSpaceSize, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion);
 
 using KernelExecutionEnvBaseT = Types::Kernel::ExecutionEnv::ExecutionEnvBaseT;
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace NEO {
+
+struct Hash128Value {
+    uint64_t low = 0u;
+    uint64_t high = 0u;
+
+    bool operator==(const Hash128Value &other) const {
+        return low == other.low && high == other.high;
+    }
+    bool operator!=(const Hash128Value &other) const {
+        return !(*this == other);
+    }
+};
+
+// Streaming 128-bit non-cryptographic hash for large inputs (e.g. compiler cache keys).
+// Input is consumed in 32-byte stripes by four independent 64-bit lanes (xxHash64-style rounds),
+// so there is no dependency chain between words and unaligned input is read with plain 64-bit loads.
+class Hash128 {
+  public:
+    static constexpr size_t laneCount = 4u;
+    static constexpr size_t stripeSize = laneCount * sizeof(uint64_t);
+
+    Hash128() {
+        reset();
+    }
+
+    void reset() {
+        lanes = {prime1 + prime2, prime2, 0u, 0u - prime1};
+        pendingSize = 0u;
+        totalSize = 0u;
+    }
+
+    void update(const char *buff, size_t size) {
+        if (buff == nullptr || size == 0u) {
+            return;
+        }
+        auto input = reinterpret_cast<const unsigned char *>(buff);
+        totalSize += size;
+
+        if (pendingSize > 0u) {
+            const size_t toCopy = std::min(size, stripeSize - pendingSize);
+            memcpy(pending.data() + pendingSize, input, toCopy);
+            pendingSize += toCopy;
+            input += toCopy;
+            size -= toCopy;
+            if (pendingSize < stripeSize) {
+                return;
+            }
+            consumeStripe(pending.data());
+            pendingSize = 0u;
+        }
+
+        while (size >= stripeSize) {
+            consumeStripe(input);
+            input += stripeSize;
+            size -= stripeSize;
+        }
+
+        if (size > 0u) {
+            memcpy(pending.data(), input, size);
+            pendingSize = size;
+        }
+    }
+
+    Hash128Value finish() const {
+        uint64_t low = 0u;
+        uint64_t high = 0u;
+        if (totalSize >= stripeSize) {
+            low = rotateLeft(lanes[0], 1) + rotateLeft(lanes[1], 7) + rotateLeft(lanes[2], 12) + rotateLeft(lanes[3], 18);
+            high = rotateLeft(lanes[3], 1) + rotateLeft(lanes[2], 7) + rotateLeft(lanes[1], 12) + rotateLeft(lanes[0], 18);
+            for (size_t i = 0; i < laneCount; i++) {
+                low = mergeLane(low, lanes[i]);
+                high = mergeLane(high, lanes[laneCount - 1 - i]);
+            }
+        } else {
+            low = prime5;
+            high = prime3;
+        }
+        low += totalSize;
+        high ^= totalSize * prime2;
+
+        size_t offset = 0u;
+        for (; offset + sizeof(uint64_t) <= pendingSize; offset += sizeof(uint64_t)) {
+            const uint64_t word = round(0u, read64(pending.data() + offset));
+            low = rotateLeft(low ^ word, 27) * prime1 + prime4;
+            high = rotateLeft(high ^ word, 31) * prime2 + prime3;
+        }
+        if (offset < pendingSize) {
+            uint64_t tail = 0u;
+            memcpy(&tail, pending.data() + offset, pendingSize - offset);
+            const uint64_t word = round(0u, tail ^ (pendingSize - offset));
+            low = rotateLeft(low ^ word, 27) * prime1 + prime4;
+            high = rotateLeft(high ^ word, 31) * prime2 + prime3;
+        }
+
+        Hash128Value value;
+        value.low = avalanche(low);
+        value.high = avalanche(high ^ value.low);
+        return value;
+    }
+
+    static Hash128Value hash(const char *buff, size_t size) {
+        Hash128 hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+  protected:
+    static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+    static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+    static constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+    static constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+    static uint64_t rotateLeft(uint64_t value, uint32_t shift) {
+        return (value << shift) | (value >> (64u - shift));
+    }
+
+    static uint64_t read64(const unsigned char *ptr) {
+        uint64_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    static uint64_t round(uint64_t accumulator, uint64_t input) {
+        accumulator += input * prime2;
+        accumulator = rotateLeft(accumulator, 31);
+        return accumulator * prime1;
+    }
+
+    static uint64_t mergeLane(uint64_t accumulator, uint64_t lane) {
+        accumulator ^= round(0u, lane);
+        return accumulator * prime1 + prime4;
+    }
+
+    static uint64_t avalanche(uint64_t value) {
+        value ^= value >> 33;
+        value *= prime2;
+        value ^= value >> 29;
+        value *= prime3;
+        value ^= value >> 32;
+        return value;
+    }
+
+    void consumeStripe(const unsigned char *stripe) {
+        for (size_t i = 0; i < laneCount; i++) {
+            lanes[i] = round(lanes[i], read64(stripe + i * sizeof(uint64_t)));
+        }
+    }
+
+    std::array<uint64_t, laneCount> lanes;
+    std::array<unsigned char, stripeSize> pending;
+    size_t pendingSize;
+    uint64_t totalSize;
+};
+} // namespace NEO
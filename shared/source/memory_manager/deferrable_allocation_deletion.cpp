@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,4 +39,12 @@ bool DeferrableAllocationDeletion::apply() {
     memoryManager.freeGraphicsMemory(&graphicsAllocation);
     return true;
 }
+
+size_t DeferrableAllocationDeletion::getSize() const {
+    return graphicsAllocation.getUnderlyingBufferSize();
+}
+
+bool DeferrableAllocationDeletion::isExternalHandle() const {
+    return graphicsAllocation.peekSharedHandle() != 0u;
+}
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,8 @@ class DeferrableAllocationDeletion : public DeferrableDeletion {
   public:
     DeferrableAllocationDeletion(MemoryManager &memoryManager, GraphicsAllocation &graphicsAllocation);
     bool apply() override;
+    size_t getSize() const override;
+    bool isExternalHandle() const override;
 
   protected:
     MemoryManager &memoryManager;
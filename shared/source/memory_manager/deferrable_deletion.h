@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,11 +8,17 @@
 #pragma once
 #include "shared/source/utilities/idlist.h"
 
+#include <cstddef>
+
 namespace NEO {
 class DeferrableDeletion : public IDNode<DeferrableDeletion> {
   public:
     template <typename... Args>
     static DeferrableDeletion *create(Args... args);
     virtual bool apply() = 0;
+
+    // used by DeferredDeleter to prioritize deletions which relieve memory pressure the most
+    virtual size_t getSize() const { return 0u; }
+    virtual bool isExternalHandle() const { return false; }
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,10 @@
 #include "shared/source/memory_manager/deferrable_deletion.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 namespace NEO {
 DeferredDeleter::DeferredDeleter() {
     doWorkInBackground = false;
@@ -50,7 +54,7 @@ DeferredDeleter::~DeferredDeleter() {
 void DeferredDeleter::deferDeletion(DeferrableDeletion *deletion) {
     std::unique_lock<std::mutex> lock(queueMutex);
     elementsToRelease++;
-    queue.pushTailOne(*deletion);
+    getQueue(*deletion).pushTailOne(*deletion);
     lock.unlock();
     condition.notify_one();
 }
@@ -90,7 +94,7 @@ void *DeferredDeleter::run(void *arg) {
     // Mark that working thread really started
     self->doWorkInBackground = true;
     do {
-        if (self->queue.peekIsEmpty()) {
+        if (self->areQueuesEmpty()) {
             // Wait for signal that some items are ready to be deleted
             self->condition.wait(lock);
         }
@@ -112,16 +116,69 @@ void DeferredDeleter::drain(bool blocking) {
     }
 }
 
+DeferredDeleter::DeletionsList &DeferredDeleter::getQueue(const DeferrableDeletion &deletion) {
+    if (deletion.isExternalHandle()) {
+        return externalHandlesQueue;
+    }
+    if (deletion.getSize() >= largeAllocationThreshold) {
+        return largeAllocationsQueue;
+    }
+    return queue;
+}
+
+bool DeferredDeleter::areQueuesEmpty() {
+    return largeAllocationsQueue.peekIsEmpty() && externalHandlesQueue.peekIsEmpty() && queue.peekIsEmpty();
+}
+
+size_t DeferredDeleter::applyDeletions(DeletionsList &deletionsList, bool largestFirst, size_t bytesToRelease) {
+    std::vector<DeferrableDeletion *> deletions;
+    auto node = deletionsList.detachNodes();
+    while (node != nullptr) {
+        auto next = node->next;
+        node->next = nullptr;
+        node->prev = nullptr;
+        deletions.push_back(node);
+        node = next;
+    }
+    if (largestFirst) {
+        std::stable_sort(deletions.begin(), deletions.end(), [](const auto *lhs, const auto *rhs) { return lhs->getSize() > rhs->getSize(); });
+    }
+
+    size_t releasedBytes = 0u;
+    for (auto deletion : deletions) {
+        if (releasedBytes >= bytesToRelease) {
+            deletionsList.pushTailOne(*deletion);
+            continue;
+        }
+        const auto deletionSize = deletion->getSize();
+        if (deletion->apply()) {
+            releasedBytes += deletionSize;
+            delete deletion;
+            elementsToRelease--;
+        } else {
+            deletionsList.pushTailOne(*deletion);
+        }
+    }
+    return releasedBytes;
+}
+
+size_t DeferredDeleter::releaseBytes(size_t bytesToRelease) {
+    size_t releasedBytes = applyDeletions(largeAllocationsQueue, true, bytesToRelease);
+    if (releasedBytes < bytesToRelease) {
+        releasedBytes += applyDeletions(externalHandlesQueue, false, bytesToRelease - releasedBytes);
+    }
+    if (releasedBytes < bytesToRelease) {
+        releasedBytes += applyDeletions(queue, false, bytesToRelease - releasedBytes);
+    }
+    return releasedBytes;
+}
+
 void DeferredDeleter::clearQueue() {
+    constexpr auto releaseAll = std::numeric_limits<size_t>::max();
     do {
-        auto deletion = queue.removeFrontOne();
-        if (deletion) {
-            if (deletion->apply()) {
-                elementsToRelease--;
-            } else {
-                queue.pushTailOne(*deletion.release());
-            }
-        }
-    } while (!queue.peekIsEmpty());
+        applyDeletions(largeAllocationsQueue, true, releaseAll);
+        applyDeletions(externalHandlesQueue, false, releaseAll);
+        applyDeletions(queue, false, releaseAll);
+    } while (!areQueuesEmpty());
 }
 } // namespace NEO
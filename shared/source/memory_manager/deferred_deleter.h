@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/idlist.h"
 
 #include <atomic>
@@ -31,7 +32,17 @@ class DeferredDeleter {
 
     MOCKABLE_VIRTUAL void drain(bool blocking);
 
+    MOCKABLE_VIRTUAL size_t releaseBytes(size_t bytesToRelease);
+
+    static constexpr size_t largeAllocationThreshold = MemoryConstants::pageSize2M;
+
   protected:
+    using DeletionsList = IDList<DeferrableDeletion, true>;
+
+    DeletionsList &getQueue(const DeferrableDeletion &deletion);
+    size_t applyDeletions(DeletionsList &deletionsList, bool largestFirst, size_t bytesToRelease);
+    bool areQueuesEmpty();
+
     void stop();
     void safeStop();
     void ensureThread();
@@ -45,7 +56,10 @@ class DeferredDeleter {
     std::atomic<int> elementsToRelease;
     std::unique_ptr<Thread> worker;
     int32_t numClients = 0;
-    IDList<DeferrableDeletion, true> queue;
+    // deletions are processed in priority order: large allocations (largest first), external handles, tiny objects
+    DeletionsList largeAllocationsQueue;
+    DeletionsList externalHandlesQueue;
+    DeletionsList queue;
     std::mutex queueMutex;
     std::mutex threadMutex;
     std::condition_variable condition;
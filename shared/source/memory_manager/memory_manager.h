@@ -211,6 +211,7 @@ class MemoryManager {
     }
 
     const ExecutionEnvironment &peekExecutionEnvironment() const { return executionEnvironment; }
+    ExecutionEnvironment &peekExecutionEnvironment() { return executionEnvironment; }
 
     MOCKABLE_VIRTUAL OsContext *createAndRegisterOsContext(CommandStreamReceiver *commandStreamReceiver,
                                                            const EngineDescriptor &engineDescriptor);
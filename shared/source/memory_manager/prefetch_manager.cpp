@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,9 @@
 
 #include "shared/source/memory_manager/prefetch_manager.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
 namespace NEO {
@@ -20,15 +22,44 @@ void PrefetchManager::insertAllocation(PrefetchContext &context, const void *usm
     std::unique_lock<SpinLock> lock{context.lock};
     if (allocData.memoryType == InternalMemoryType::sharedUnifiedMemory) {
         context.allocations.push_back(usmPtr);
+        context.allocationsLookup.insert(usmPtr);
     }
 }
 
+bool PrefetchManager::isPredictivePrefetchEnabled() {
+    return debugManager.flags.EnablePredictiveUsmPrefetch.get() == 1;
+}
+
+bool PrefetchManager::insertKernelAllocations(PrefetchContext &context, SVMAllocsManager &unifiedMemoryManager, const std::vector<GraphicsAllocation *> &kernelAllocations) {
+    bool inserted = false;
+    std::unique_lock<SpinLock> lock{context.lock};
+    for (auto allocation : kernelAllocations) {
+        if (allocation == nullptr) {
+            continue;
+        }
+        auto allocData = unifiedMemoryManager.getSVMAlloc(reinterpret_cast<const void *>(allocation->getGpuAddress()));
+        if (allocData == nullptr || allocData->memoryType != InternalMemoryType::sharedUnifiedMemory) {
+            continue;
+        }
+        auto usmPtr = reinterpret_cast<const void *>(allocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress());
+        if (false == context.allocationsLookup.insert(usmPtr).second) {
+            continue;
+        }
+        context.allocations.push_back(usmPtr);
+        predictedAllocationsCount++;
+        inserted = true;
+    }
+    return inserted;
+}
+
 void PrefetchManager::migrateAllocationsToGpu(PrefetchContext &context, SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr) {
     std::unique_lock<SpinLock> lock{context.lock};
     for (auto &ptr : context.allocations) {
         auto allocData = unifiedMemoryManager.getSVMAlloc(ptr);
         if (allocData) {
             unifiedMemoryManager.prefetchMemory(device, csr, *allocData);
+            prefetchedAllocationsCount++;
+            prefetchedBytes += allocData->size;
         }
     }
 }
@@ -36,6 +67,7 @@ void PrefetchManager::migrateAllocationsToGpu(PrefetchContext &context, SVMAlloc
 void PrefetchManager::removeAllocations(PrefetchContext &context) {
     std::unique_lock<SpinLock> lock{context.lock};
     context.allocations.clear();
+    context.allocationsLookup.clear();
 }
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,7 +10,9 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <atomic>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 namespace NEO {
@@ -18,10 +20,12 @@ struct SvmAllocationData;
 
 class CommandStreamReceiver;
 class Device;
+class GraphicsAllocation;
 class SVMAllocsManager;
 
 struct PrefetchContext {
     std::vector<const void *> allocations;
+    std::unordered_set<const void *> allocationsLookup;
     SpinLock lock;
 };
 
@@ -31,11 +35,26 @@ class PrefetchManager : public NonCopyableOrMovableClass {
 
     virtual ~PrefetchManager() = default;
 
+    static bool isPredictivePrefetchEnabled();
+
     void insertAllocation(PrefetchContext &context, const void *usmPtr, SvmAllocationData &allocData);
 
+    // Predictive mode: shared USM allocations referenced by a kernel are prefetched on submission
+    // instead of being migrated on first GPU access. Returns true if any allocation was added to the context.
+    bool insertKernelAllocations(PrefetchContext &context, SVMAllocsManager &unifiedMemoryManager, const std::vector<GraphicsAllocation *> &kernelAllocations);
+
     MOCKABLE_VIRTUAL void migrateAllocationsToGpu(PrefetchContext &context, SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr);
 
     MOCKABLE_VIRTUAL void removeAllocations(PrefetchContext &context);
+
+    uint64_t getPredictedAllocationsCount() const { return predictedAllocationsCount.load(); }
+    uint64_t getPrefetchedAllocationsCount() const { return prefetchedAllocationsCount.load(); }
+    uint64_t getPrefetchedBytes() const { return prefetchedBytes.load(); }
+
+  protected:
+    std::atomic<uint64_t> predictedAllocationsCount{0u};
+    std::atomic<uint64_t> prefetchedAllocationsCount{0u};
+    std::atomic<uint64_t> prefetchedBytes{0u};
 };
 
 } // namespace NEO
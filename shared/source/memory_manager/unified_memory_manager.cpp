@@ -18,6 +18,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/compression_selector.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/unified_memory_reuse_cleaner.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
@@ -42,37 +43,176 @@ void SVMAllocsManager::MapBasedAllocationTracker::remove(const SvmAllocationData
     allocations.erase(iter);
 }
 
-void SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
+namespace {
+bool isSmallerThanSize(const SVMAllocsManager::SvmAllocationCache::AllocationsByAge::iterator &ageIter, size_t size) {
+    return ageIter->allocationSize < size;
+}
+} // namespace
+
+uint32_t SVMAllocsManager::SvmAllocationCache::getBucketIndex(size_t size) {
+    if (size < subBucketsCount) {
+        return static_cast<uint32_t>(size);
+    }
+    const auto powerOfTwo = Math::log2(static_cast<uint64_t>(size));
+    const auto subBucket = static_cast<uint32_t>(size >> (powerOfTwo - subBucketsShift)) & (subBucketsCount - 1);
+    return powerOfTwo * subBucketsCount + subBucket;
+}
+
+bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
+    if (size > this->maxHeldBytes) {
+        return false;
+    }
     std::lock_guard<std::mutex> lock(this->mtx);
-    allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr);
+    if (!this->releaseOldestAllocations(size)) {
+        return false;
+    }
+    auto ageIter = this->allocationsByAge.emplace(this->allocationsByAge.end(), size, ptr, std::chrono::steady_clock::now());
+    auto &bucket = this->buckets[getBucketIndex(size)];
+    bucket.insert(std::lower_bound(bucket.begin(), bucket.end(), size, isSmallerThanSize), ageIter);
+    ++this->numAllocations;
+    this->heldBytes += size;
+    return true;
 }
 
-void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager) {
+void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties) {
     std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
-         allocationIter != allocations.end();
-         ++allocationIter) {
-        void *allocationPtr = allocationIter->allocation;
-        SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
-        UNRECOVERABLE_IF(!svmAllocData);
-        if (svmAllocData->device == unifiedMemoryProperties.device &&
-            svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
-            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
-            allocations.erase(allocationIter);
-            return allocationPtr;
+    for (auto bucketIndex = getBucketIndex(size); bucketIndex < bucketsCount; ++bucketIndex) {
+        auto &bucket = this->buckets[bucketIndex];
+        for (auto bucketIter = std::lower_bound(bucket.begin(), bucket.end(), size, isSmallerThanSize);
+             bucketIter != bucket.end();
+             ++bucketIter) {
+            void *allocationPtr = (*bucketIter)->allocation;
+            SvmAllocationData *svmAllocData = this->svmAllocsManager->getSVMAlloc(allocationPtr);
+            UNRECOVERABLE_IF(!svmAllocData);
+            if (svmAllocData->device == unifiedMemoryProperties.device &&
+                svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
+                svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
+                this->removeFromCache(bucket, bucketIter);
+                ++this->hits;
+                return allocationPtr;
+            }
         }
     }
+    ++this->misses;
     return nullptr;
 }
 
-void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManager) {
+void SVMAllocsManager::SvmAllocationCache::trim() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    for (auto &cachedAllocationInfo : this->allocationsByAge) {
+        SvmAllocationData *svmData = this->svmAllocsManager->getSVMAlloc(cachedAllocationInfo.allocation);
+        DEBUG_BREAK_IF(nullptr == svmData);
+        this->svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::none, svmData);
+    }
+    this->allocationsByAge.clear();
+    for (auto &bucket : this->buckets) {
+        bucket.clear();
+    }
+    this->numAllocations = 0u;
+    this->heldBytes = 0u;
+}
+
+void SVMAllocsManager::SvmAllocationCache::trimOldAllocs(std::chrono::steady_clock::time_point trimTimePoint) {
     std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto &cachedAllocationInfo : this->allocations) {
-        SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(cachedAllocationInfo.allocation);
+    for (auto ageIter = this->allocationsByAge.begin();
+         ageIter != this->allocationsByAge.end() && trimTimePoint - ageIter->saveTime > this->maxAge;) {
+        void *allocationPtr = ageIter->allocation;
+        SvmAllocationData *svmData = this->svmAllocsManager->getSVMAlloc(allocationPtr);
+        DEBUG_BREAK_IF(nullptr == svmData);
+        if (this->isInUse(svmData)) {
+            ++ageIter;
+            continue;
+        }
+        ageIter = this->removeFromCache(ageIter);
+        this->svmAllocsManager->freeSVMAllocImpl(allocationPtr, FreePolicyType::none, svmData);
+    }
+}
+
+bool SVMAllocsManager::SvmAllocationCache::releaseOldestAllocations(size_t size) {
+    for (auto ageIter = this->allocationsByAge.begin(); this->heldBytes + size > this->maxHeldBytes;) {
+        if (ageIter == this->allocationsByAge.end()) {
+            return false;
+        }
+        void *allocationPtr = ageIter->allocation;
+        SvmAllocationData *svmData = this->svmAllocsManager->getSVMAlloc(allocationPtr);
         DEBUG_BREAK_IF(nullptr == svmData);
-        svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::none, svmData);
+        if (this->isInUse(svmData)) {
+            ++ageIter;
+            continue;
+        }
+        ageIter = this->removeFromCache(ageIter);
+        this->svmAllocsManager->freeSVMAllocImpl(allocationPtr, FreePolicyType::none, svmData);
+    }
+    return true;
+}
+
+bool SVMAllocsManager::SvmAllocationCache::isInUse(SvmAllocationData *svmData) {
+    auto memoryManager = this->svmAllocsManager->memoryManager;
+    if (svmData->cpuAllocation && memoryManager->allocInUse(*svmData->cpuAllocation)) {
+        return true;
     }
-    this->allocations.clear();
+    for (auto &gpuAllocation : svmData->gpuAllocations.getGraphicsAllocations()) {
+        if (gpuAllocation && memoryManager->allocInUse(*gpuAllocation)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+SVMAllocsManager::SvmAllocationCache::AllocationsByAge::iterator SVMAllocsManager::SvmAllocationCache::removeFromCache(AllocationsByAge::iterator ageIter) {
+    auto &bucket = this->buckets[getBucketIndex(ageIter->allocationSize)];
+    auto bucketIter = std::lower_bound(bucket.begin(), bucket.end(), ageIter->allocationSize, isSmallerThanSize);
+    while (*bucketIter != ageIter) {
+        ++bucketIter;
+    }
+    return this->removeFromCache(bucket, bucketIter);
+}
+
+SVMAllocsManager::SvmAllocationCache::AllocationsByAge::iterator SVMAllocsManager::SvmAllocationCache::removeFromCache(Bucket &bucket, Bucket::iterator bucketIter) {
+    auto ageIter = *bucketIter;
+    --this->numAllocations;
+    this->heldBytes -= ageIter->allocationSize;
+    bucket.erase(bucketIter);
+    return this->allocationsByAge.erase(ageIter);
+}
+
+bool SVMAllocsManager::SvmAllocationCache::isInCache(void *ptr) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    for (auto &cachedAllocationInfo : this->allocationsByAge) {
+        if (cachedAllocationInfo.allocation == ptr) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t SVMAllocsManager::SvmAllocationCache::getNumAllocations() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    return this->numAllocations;
+}
+
+size_t SVMAllocsManager::SvmAllocationCache::getHeldBytes() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    return this->heldBytes;
+}
+
+uint64_t SVMAllocsManager::SvmAllocationCache::getHits() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    return this->hits;
+}
+
+uint64_t SVMAllocsManager::SvmAllocationCache::getMisses() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    return this->misses;
+}
+
+void SVMAllocsManager::SvmAllocationCache::printStatistics(const char *cacheName) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    const auto requests = this->hits + this->misses;
+    const auto hitRate = requests > 0u ? 100.0 * static_cast<double>(this->hits) / static_cast<double>(requests) : 0.0;
+    PRINT_DEBUG_STRING(debugManager.flags.PrintUsmAllocationsCacheStatistics.get(), stdout,
+                       "%s: hits: %llu, misses: %llu, hit rate: %.2f%%, held allocations: %zu, held bytes: %zu\n",
+                       cacheName, static_cast<unsigned long long>(this->hits), static_cast<unsigned long long>(this->misses), hitRate, this->numAllocations, this->heldBytes);
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
@@ -183,7 +323,18 @@ SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsCon
     }
 }
 
-SVMAllocsManager::~SVMAllocsManager() = default;
+SVMAllocsManager::~SVMAllocsManager() {
+    if (this->unifiedMemoryReuseCleaner) {
+        this->unifiedMemoryReuseCleaner->unregisterSvmAllocationCache(&this->usmDeviceAllocationsCache);
+        this->unifiedMemoryReuseCleaner->unregisterSvmAllocationCache(&this->usmHostAllocationsCache);
+    }
+    if (this->usmDeviceAllocationsCacheEnabled) {
+        this->usmDeviceAllocationsCache.printStatistics("USM device allocations cache");
+    }
+    if (this->usmHostAllocationsCacheEnabled) {
+        this->usmHostAllocationsCache.printStatistics("USM host allocations cache");
+    }
+}
 
 void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationProperties svmProperties,
                                        const RootDeviceIndicesContainer &rootDeviceIndices,
@@ -230,7 +381,7 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     unifiedMemoryProperties.cacheRegion = MemoryPropertiesHelper::getCacheRegion(memoryProperties.allocationFlags);
 
     if (this->usmHostAllocationsCacheEnabled) {
-        void *allocationFromCache = this->usmHostAllocationsCache.get(size, memoryProperties, this);
+        void *allocationFromCache = this->usmHostAllocationsCache.get(size, memoryProperties);
         if (allocationFromCache) {
             return allocationFromCache;
         }
@@ -307,7 +458,7 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
     if (memoryProperties.memoryType == InternalMemoryType::deviceUnifiedMemory) {
         unifiedMemoryProperties.flags.isUSMDeviceAllocation = true;
         if (this->usmDeviceAllocationsCacheEnabled) {
-            void *allocationFromCache = this->usmDeviceAllocationsCache.get(size, memoryProperties, this);
+            void *allocationFromCache = this->usmDeviceAllocationsCache.get(size, memoryProperties);
             if (allocationFromCache) {
                 return allocationFromCache;
             }
@@ -456,13 +607,13 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
     SvmAllocationData *svmData = getSVMAlloc(ptr);
     if (svmData) {
         if (InternalMemoryType::deviceUnifiedMemory == svmData->memoryType &&
-            this->usmDeviceAllocationsCacheEnabled) {
-            this->usmDeviceAllocationsCache.insert(svmData->size, ptr);
+            this->usmDeviceAllocationsCacheEnabled &&
+            this->usmDeviceAllocationsCache.insert(svmData->size, ptr)) {
             return true;
         }
         if (InternalMemoryType::hostUnifiedMemory == svmData->memoryType &&
-            this->usmHostAllocationsCacheEnabled) {
-            this->usmHostAllocationsCache.insert(svmData->size, ptr);
+            this->usmHostAllocationsCacheEnabled &&
+            this->usmHostAllocationsCache.insert(svmData->size, ptr)) {
             return true;
         }
         if (blocking) {
@@ -484,13 +635,13 @@ bool SVMAllocsManager::freeSVMAllocDefer(void *ptr) {
     SvmAllocationData *svmData = getSVMAlloc(ptr);
     if (svmData) {
         if (InternalMemoryType::deviceUnifiedMemory == svmData->memoryType &&
-            this->usmDeviceAllocationsCacheEnabled) {
-            this->usmDeviceAllocationsCache.insert(svmData->size, ptr);
+            this->usmDeviceAllocationsCacheEnabled &&
+            this->usmDeviceAllocationsCache.insert(svmData->size, ptr)) {
             return true;
         }
         if (InternalMemoryType::hostUnifiedMemory == svmData->memoryType &&
-            this->usmHostAllocationsCacheEnabled) {
-            this->usmHostAllocationsCache.insert(svmData->size, ptr);
+            this->usmHostAllocationsCacheEnabled &&
+            this->usmHostAllocationsCache.insert(svmData->size, ptr)) {
             return true;
         }
         this->freeSVMAllocImpl(ptr, FreePolicyType::defer, svmData);
@@ -559,11 +710,11 @@ void SVMAllocsManager::freeSVMAllocDeferImpl() {
 }
 
 void SVMAllocsManager::trimUSMDeviceAllocCache() {
-    this->usmDeviceAllocationsCache.trim(this);
+    this->usmDeviceAllocationsCache.trim();
 }
 
 void SVMAllocsManager::trimUSMHostAllocCache() {
-    this->usmHostAllocationsCache.trim(this);
+    this->usmHostAllocationsCache.trim();
 }
 
 void *SVMAllocsManager::createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
@@ -685,11 +836,25 @@ void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
 }
 
 void SVMAllocsManager::initUsmDeviceAllocationsCache() {
-    this->usmDeviceAllocationsCache.allocations.reserve(128u);
+    this->initUsmAllocationsCache(this->usmDeviceAllocationsCache);
 }
 
 void SVMAllocsManager::initUsmHostAllocationsCache() {
-    this->usmHostAllocationsCache.allocations.reserve(128u);
+    this->initUsmAllocationsCache(this->usmHostAllocationsCache);
+}
+
+void SVMAllocsManager::initUsmAllocationsCache(SvmAllocationCache &cache) {
+    cache.svmAllocsManager = this;
+    if (debugManager.flags.ExperimentalUsmAllocationsCacheMaxBytes.get() != -1) {
+        cache.maxHeldBytes = static_cast<size_t>(debugManager.flags.ExperimentalUsmAllocationsCacheMaxBytes.get());
+    }
+    if (debugManager.flags.ExperimentalUsmAllocationsCacheMaxAge.get() > 0) {
+        cache.maxAge = std::chrono::milliseconds(debugManager.flags.ExperimentalUsmAllocationsCacheMaxAge.get());
+        if (this->unifiedMemoryReuseCleaner == nullptr) {
+            this->unifiedMemoryReuseCleaner = this->memoryManager->peekExecutionEnvironment().initializeUnifiedMemoryReuseCleaner();
+        }
+        this->unifiedMemoryReuseCleaner->registerSvmAllocationCache(&cache);
+    }
 }
 
 void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData) {
@@ -11,12 +11,17 @@
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/source/utilities/sorted_map.h"
 #include "shared/source/utilities/sorted_vector.h"
 
 #include "memory_properties_flags.h"
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <limits>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -27,6 +32,7 @@ namespace NEO {
 class CommandStreamReceiver;
 class GraphicsAllocation;
 class MemoryManager;
+class UnifiedMemoryReuseCleaner;
 class Device;
 struct VirtualMemoryReservation;
 
@@ -86,6 +92,7 @@ struct SvmMapOperation {
 class SVMAllocsManager {
   public:
     using SortedVectorBasedAllocationTracker = BaseSortedPointerWithValueVector<SvmAllocationData>;
+    using SortedMapBasedAllocationTracker = BaseSortedPointerWithValueMap<SvmAllocationData>;
 
     class MapBasedAllocationTracker {
         friend class SVMAllocsManager;
@@ -143,7 +150,8 @@ class SVMAllocsManager {
     struct SvmCacheAllocationInfo {
         size_t allocationSize;
         void *allocation;
-        SvmCacheAllocationInfo(size_t allocationSize, void *allocation) : allocationSize(allocationSize), allocation(allocation) {}
+        std::chrono::steady_clock::time_point saveTime;
+        SvmCacheAllocationInfo(size_t allocationSize, void *allocation, std::chrono::steady_clock::time_point saveTime) : allocationSize(allocationSize), allocation(allocation), saveTime(saveTime) {}
         bool operator<(SvmCacheAllocationInfo const &other) const {
             return allocationSize < other.allocationSize;
         }
@@ -152,11 +160,46 @@ class SVMAllocsManager {
         }
     };
 
+    // Reuse cache of freed USM allocations.
+    // Allocations are kept in a list ordered by save time and indexed by size classes (power of two split into
+    // subBucketsCount steps), each sorted by size, so lookup starts directly at the class of requested size.
+    // Cache is bounded by byte budget (oldest allocations are released first) and, when max age is set, allocations
+    // unused for longer are released by UnifiedMemoryReuseCleaner. Allocations still used by GPU are never released
+    // from the cache, they are kept until a later trim.
     struct SvmAllocationCache {
-        void insert(size_t size, void *);
-        void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
-        void trim(SVMAllocsManager *svmAllocsManager);
-        std::vector<SvmCacheAllocationInfo> allocations;
+        using AllocationsByAge = std::list<SvmCacheAllocationInfo>;
+        using Bucket = std::vector<AllocationsByAge::iterator>;
+
+        static constexpr uint32_t subBucketsShift = 2u;
+        static constexpr uint32_t subBucketsCount = 1u << subBucketsShift;
+        static constexpr uint32_t bucketsCount = static_cast<uint32_t>(sizeof(size_t) * 8) * subBucketsCount;
+        static uint32_t getBucketIndex(size_t size);
+
+        bool insert(size_t size, void *);
+        void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties);
+        void trim();
+        void trimOldAllocs(std::chrono::steady_clock::time_point trimTimePoint);
+        bool isInCache(void *ptr);
+        size_t getNumAllocations();
+        size_t getHeldBytes();
+        uint64_t getHits();
+        uint64_t getMisses();
+        void printStatistics(const char *cacheName);
+
+        bool releaseOldestAllocations(size_t size);
+        bool isInUse(SvmAllocationData *svmData);
+        AllocationsByAge::iterator removeFromCache(AllocationsByAge::iterator ageIter);
+        AllocationsByAge::iterator removeFromCache(Bucket &bucket, Bucket::iterator bucketIter);
+
+        AllocationsByAge allocationsByAge;
+        std::array<Bucket, bucketsCount> buckets;
+        SVMAllocsManager *svmAllocsManager = nullptr;
+        size_t maxHeldBytes = std::numeric_limits<size_t>::max();
+        std::chrono::milliseconds maxAge{0};
+        size_t numAllocations = 0u;
+        size_t heldBytes = 0u;
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
         std::mutex mtx;
     };
 
@@ -210,7 +253,7 @@ class SVMAllocsManager {
     void removeSVMAlloc(const SvmAllocationData &svmData);
     size_t getNumAllocs() const { return svmAllocs.getNumAllocs(); }
     MOCKABLE_VIRTUAL size_t getNumDeferFreeAllocs() const { return svmDeferFreeAllocs.getNumAllocs(); }
-    SortedVectorBasedAllocationTracker *getSVMAllocs() { return &svmAllocs; }
+    SortedMapBasedAllocationTracker *getSVMAllocs() { return &svmAllocs; }
 
     MOCKABLE_VIRTUAL void insertSvmMapOperation(void *regionSvmPtr, size_t regionSize, void *baseSvmPtr, size_t offset, bool readOnlyMap);
     void removeSvmMapOperation(const void *regionSvmPtr);
@@ -244,9 +287,10 @@ class SVMAllocsManager {
 
     void initUsmDeviceAllocationsCache();
     void initUsmHostAllocationsCache();
+    void initUsmAllocationsCache(SvmAllocationCache &cache);
     void freeSVMData(SvmAllocationData *svmData);
 
-    SortedVectorBasedAllocationTracker svmAllocs;
+    SortedMapBasedAllocationTracker svmAllocs;
     MapOperationsTracker svmMapOperations;
     MapBasedAllocationTracker svmDeferFreeAllocs;
     MemoryManager *memoryManager;
@@ -257,5 +301,6 @@ class SVMAllocsManager {
     SvmAllocationCache usmHostAllocationsCache;
     bool usmDeviceAllocationsCacheEnabled = false;
     bool usmHostAllocationsCacheEnabled = false;
+    UnifiedMemoryReuseCleaner *unifiedMemoryReuseCleaner = nullptr;
 };
 } // namespace NEO
@@ -15,17 +15,22 @@
 namespace NEO {
 
 bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize) {
-    this->pool = svmMemoryManager->createUnifiedMemoryAllocation(poolSize, memoryProperties);
-    if (nullptr == this->pool) {
+    auto poolPtr = svmMemoryManager->createUnifiedMemoryAllocation(poolSize, memoryProperties);
+    return initialize(svmMemoryManager, poolPtr, memoryProperties.memoryType, poolSize);
+}
+
+bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, void *poolPtr, InternalMemoryType poolMemoryType, size_t poolSize) {
+    if (nullptr == poolPtr) {
         return false;
     }
+    this->pool = poolPtr;
     this->svmMemoryManager = svmMemoryManager;
     this->poolEnd = ptrOffset(this->pool, poolSize);
     this->chunkAllocator.reset(new HeapAllocator(startingOffset,
                                                  poolSize,
                                                  chunkAlignment));
     this->poolSize = poolSize;
-    this->poolMemoryType = memoryProperties.memoryType;
+    this->poolMemoryType = poolMemoryType;
     return true;
 }
 
@@ -33,17 +38,33 @@ bool UsmMemAllocPool::isInitialized() {
     return this->pool;
 }
 
+bool UsmMemAllocPool::isEmpty() {
+    std::unique_lock<std::mutex> lock(mtx);
+    return this->allocations.getNumAllocs() == 0u;
+}
+
 void UsmMemAllocPool::cleanup() {
     if (isInitialized()) {
         this->svmMemoryManager->freeSVMAlloc(this->pool, true);
-        this->svmMemoryManager = nullptr;
-        this->pool = nullptr;
-        this->poolEnd = nullptr;
-        this->poolSize = 0u;
-        this->poolMemoryType = InternalMemoryType::notSpecified;
+        resetPool();
     }
 }
 
+void UsmMemAllocPool::cleanupDeferred() {
+    if (isInitialized()) {
+        this->svmMemoryManager->freeSVMAllocDefer(this->pool);
+        resetPool();
+    }
+}
+
+void UsmMemAllocPool::resetPool() {
+    this->svmMemoryManager = nullptr;
+    this->pool = nullptr;
+    this->poolEnd = nullptr;
+    this->poolSize = 0u;
+    this->poolMemoryType = InternalMemoryType::notSpecified;
+}
+
 bool UsmMemAllocPool::alignmentIsAllowed(size_t alignment) {
     return alignment % chunkAlignment == 0;
 }
@@ -124,4 +145,174 @@ void *UsmMemAllocPool::getPooledAllocationBasePtr(const void *ptr) {
     return nullptr;
 }
 
-} // namespace NEO
\ No newline at end of file
+bool UsmMemAllocPoolsManager::isEnabled() {
+    return debugManager.flags.EnableUsmAllocationPoolsManager.get() == 1;
+}
+
+UsmMemAllocPoolsManager::PoolTier UsmMemAllocPoolsManager::getPoolTier(size_t size) {
+    if (size < tinyAllocationThreshold) {
+        return PoolTier::tiny;
+    }
+    if (size < smallAllocationThreshold) {
+        return PoolTier::small;
+    }
+    return PoolTier::medium;
+}
+
+UsmMemAllocPoolsManager::~UsmMemAllocPoolsManager() {
+    cleanup();
+}
+
+void UsmMemAllocPoolsManager::initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, void *cmdQ) {
+    std::unique_lock<std::mutex> lock(mtx);
+    this->svmMemoryManager = svmMemoryManager;
+    this->cmdQ = cmdQ;
+    this->poolMemoryType = memoryProperties.memoryType;
+    this->device = memoryProperties.device;
+    this->rootDeviceIndices = memoryProperties.rootDeviceIndices;
+    this->subdeviceBitfields = memoryProperties.subdeviceBitfields;
+    if (debugManager.flags.UsmAllocationPoolsIdleTime.get() != -1) {
+        this->poolIdleTime = std::chrono::milliseconds(debugManager.flags.UsmAllocationPoolsIdleTime.get());
+    }
+}
+
+void UsmMemAllocPoolsManager::cleanup() {
+    std::unique_lock<std::mutex> lock(mtx);
+    for (auto &tierPools : this->pools) {
+        for (auto &poolInfo : tierPools) {
+            poolInfo.pool->cleanup();
+        }
+        tierPools.clear();
+    }
+    this->svmMemoryManager = nullptr;
+}
+
+bool UsmMemAllocPoolsManager::canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    return size <= UsmMemAllocPool::allocationThreshold &&
+           UsmMemAllocPool::alignmentIsAllowed(memoryProperties.alignment) &&
+           memoryProperties.memoryType == this->poolMemoryType &&
+           memoryProperties.device == this->device &&
+           memoryProperties.allocationFlags.allFlags == 0u &&
+           memoryProperties.allocationFlags.allAllocFlags == 0u;
+}
+
+UsmMemAllocPool *UsmMemAllocPoolsManager::addPool(PoolTier tier) {
+    const auto poolSize = tierPoolSizes[static_cast<uint32_t>(tier)];
+    UnifiedMemoryProperties poolMemoryProperties(this->poolMemoryType, MemoryConstants::pageSize2M, this->rootDeviceIndices, this->subdeviceBitfields);
+    poolMemoryProperties.device = this->device;
+
+    void *poolPtr = nullptr;
+    if (this->poolMemoryType == InternalMemoryType::sharedUnifiedMemory) {
+        poolPtr = this->svmMemoryManager->createSharedUnifiedMemoryAllocation(poolSize, poolMemoryProperties, this->cmdQ);
+    } else {
+        poolPtr = this->svmMemoryManager->createUnifiedMemoryAllocation(poolSize, poolMemoryProperties);
+    }
+
+    auto pool = std::make_unique<UsmMemAllocPool>();
+    if (false == pool->initialize(this->svmMemoryManager, poolPtr, this->poolMemoryType, poolSize)) {
+        return nullptr;
+    }
+    auto &tierPools = this->pools[static_cast<uint32_t>(tier)];
+    tierPools.push_back({std::move(pool), this->getCpuTimestamp()});
+    return tierPools.back().pool.get();
+}
+
+void *UsmMemAllocPoolsManager::createUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    if (false == isInitialized() || false == canBePooled(size, memoryProperties)) {
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    const auto now = this->getCpuTimestamp();
+    this->trimIdlePoolsImpl(now);
+
+    const auto tier = getPoolTier(size);
+    for (auto &poolInfo : this->pools[static_cast<uint32_t>(tier)]) {
+        if (auto pooledPtr = poolInfo.pool->createUnifiedMemoryAllocation(size, memoryProperties)) {
+            poolInfo.lastUsedTime = now;
+            return pooledPtr;
+        }
+    }
+
+    auto newPool = this->addPool(tier);
+    if (nullptr == newPool) {
+        return nullptr;
+    }
+    return newPool->createUnifiedMemoryAllocation(size, memoryProperties);
+}
+
+UsmMemAllocPoolsManager::PoolInfo *UsmMemAllocPoolsManager::getPoolInfo(const void *ptr) {
+    for (auto &tierPools : this->pools) {
+        for (auto &poolInfo : tierPools) {
+            if (poolInfo.pool->isInPool(ptr)) {
+                return &poolInfo;
+            }
+        }
+    }
+    return nullptr;
+}
+
+bool UsmMemAllocPoolsManager::freeSVMAlloc(void *ptr, bool blocking) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto poolInfo = this->getPoolInfo(ptr);
+    if (nullptr == poolInfo || false == poolInfo->pool->freeSVMAlloc(ptr, blocking)) {
+        return false;
+    }
+    const auto now = this->getCpuTimestamp();
+    poolInfo->lastUsedTime = now;
+    this->trimIdlePoolsImpl(now);
+    return true;
+}
+
+size_t UsmMemAllocPoolsManager::getPooledAllocationSize(const void *ptr) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto poolInfo = this->getPoolInfo(ptr);
+    return poolInfo ? poolInfo->pool->getPooledAllocationSize(ptr) : 0u;
+}
+
+void *UsmMemAllocPoolsManager::getPooledAllocationBasePtr(const void *ptr) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto poolInfo = this->getPoolInfo(ptr);
+    return poolInfo ? poolInfo->pool->getPooledAllocationBasePtr(ptr) : nullptr;
+}
+
+void UsmMemAllocPoolsManager::trimIdlePools(std::chrono::steady_clock::time_point now) {
+    std::unique_lock<std::mutex> lock(mtx);
+    this->trimIdlePoolsImpl(now);
+}
+
+void UsmMemAllocPoolsManager::trimIdlePoolsImpl(std::chrono::steady_clock::time_point now) {
+    for (auto &tierPools : this->pools) {
+        for (auto poolIter = tierPools.begin(); poolIter != tierPools.end();) {
+            if (now - poolIter->lastUsedTime > this->poolIdleTime && poolIter->pool->isEmpty()) {
+                // pool memory may still be used by GPU work of freed pooled allocations, do not wait for it here
+                poolIter->pool->cleanupDeferred();
+                poolIter = tierPools.erase(poolIter);
+            } else {
+                ++poolIter;
+            }
+        }
+    }
+}
+
+size_t UsmMemAllocPoolsManager::getPoolsCount(PoolTier tier) {
+    std::unique_lock<std::mutex> lock(mtx);
+    return this->pools[static_cast<uint32_t>(tier)].size();
+}
+
+size_t UsmMemAllocPoolsManager::getTotalPoolsSize() {
+    std::unique_lock<std::mutex> lock(mtx);
+    size_t totalSize = 0u;
+    for (auto &tierPools : this->pools) {
+        for (auto &poolInfo : tierPools) {
+            totalSize += poolInfo.pool->getPoolSize();
+        }
+    }
+    return totalSize;
+}
+
+std::chrono::steady_clock::time_point UsmMemAllocPoolsManager::getCpuTimestamp() {
+    return std::chrono::steady_clock::now();
+}
+
+} // namespace NEO
@@ -9,7 +9,12 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/heap_allocator.h"
-#include "shared/source/utilities/sorted_vector.h"
+#include "shared/source/utilities/sorted_map.h"
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <vector>
 
 namespace NEO {
 class UsmMemAllocPool {
@@ -20,13 +25,17 @@ class UsmMemAllocPool {
         size_t size;
         size_t requestedSize;
     };
-    using AllocationsInfoStorage = BaseSortedPointerWithValueVector<AllocationInfo>;
+    using AllocationsInfoStorage = BaseSortedPointerWithValueMap<AllocationInfo>;
 
     UsmMemAllocPool() = default;
     bool initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize);
+    bool initialize(SVMAllocsManager *svmMemoryManager, void *poolPtr, InternalMemoryType poolMemoryType, size_t poolSize);
     bool isInitialized();
+    bool isEmpty();
+    size_t getPoolSize() const { return poolSize; }
     void cleanup();
-    bool alignmentIsAllowed(size_t alignment);
+    void cleanupDeferred();
+    static bool alignmentIsAllowed(size_t alignment);
     bool canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties);
     void *createUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties);
     bool isInPool(const void *ptr);
@@ -39,6 +48,8 @@ class UsmMemAllocPool {
     static constexpr auto startingOffset = 2 * allocationThreshold;
 
   protected:
+    void resetPool();
+
     size_t poolSize{};
     std::unique_ptr<HeapAllocator> chunkAllocator;
     void *pool{};
@@ -49,4 +60,62 @@ class UsmMemAllocPool {
     InternalMemoryType poolMemoryType;
 };
 
+// Grows USM pooling beyond a single UsmMemAllocPool.
+// Small allocations are sub-allocated from pools grouped in size tiers, a pool is added when all pools of a tier are full
+// and pools which stay empty for longer than poolIdleTime are released with deferred free on next allocation or free.
+class UsmMemAllocPoolsManager {
+  public:
+    using UnifiedMemoryProperties = SVMAllocsManager::UnifiedMemoryProperties;
+    enum class PoolTier : uint32_t {
+        tiny = 0u,
+        small,
+        medium
+    };
+    static constexpr uint32_t poolTiersCount = 3u;
+    static constexpr size_t tinyAllocationThreshold = 4 * MemoryConstants::kiloByte;
+    static constexpr size_t smallAllocationThreshold = 64 * MemoryConstants::kiloByte;
+    static constexpr std::array<size_t, poolTiersCount> tierPoolSizes = {2 * MemoryConstants::megaByte,
+                                                                         4 * MemoryConstants::megaByte,
+                                                                         16 * MemoryConstants::megaByte};
+    static constexpr std::chrono::milliseconds defaultPoolIdleTime{1000};
+
+    static bool isEnabled();
+    static PoolTier getPoolTier(size_t size);
+
+    UsmMemAllocPoolsManager() = default;
+    MOCKABLE_VIRTUAL ~UsmMemAllocPoolsManager();
+    void initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, void *cmdQ);
+    bool isInitialized() const { return svmMemoryManager != nullptr; }
+    void cleanup();
+    void *createUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties);
+    bool freeSVMAlloc(void *ptr, bool blocking);
+    size_t getPooledAllocationSize(const void *ptr);
+    void *getPooledAllocationBasePtr(const void *ptr);
+    bool canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties);
+    void trimIdlePools(std::chrono::steady_clock::time_point now);
+    size_t getPoolsCount(PoolTier tier);
+    size_t getTotalPoolsSize();
+
+  protected:
+    struct PoolInfo {
+        std::unique_ptr<UsmMemAllocPool> pool;
+        std::chrono::steady_clock::time_point lastUsedTime;
+    };
+
+    UsmMemAllocPool *addPool(PoolTier tier);
+    PoolInfo *getPoolInfo(const void *ptr);
+    void trimIdlePoolsImpl(std::chrono::steady_clock::time_point now);
+    MOCKABLE_VIRTUAL std::chrono::steady_clock::time_point getCpuTimestamp();
+
+    std::array<std::vector<PoolInfo>, poolTiersCount> pools;
+    SVMAllocsManager *svmMemoryManager = nullptr;
+    void *cmdQ = nullptr;
+    InternalMemoryType poolMemoryType = InternalMemoryType::notSpecified;
+    Device *device = nullptr;
+    RootDeviceIndicesContainer rootDeviceIndices;
+    std::map<uint32_t, DeviceBitfield> subdeviceBitfields;
+    std::chrono::milliseconds poolIdleTime = defaultPoolIdleTime;
+    std::mutex mtx;
+};
+
 } // namespace NEO
\ No newline at end of file
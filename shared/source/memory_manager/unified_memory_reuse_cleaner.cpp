@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/unified_memory_reuse_cleaner.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace NEO {
+
+UnifiedMemoryReuseCleaner::UnifiedMemoryReuseCleaner() {
+    unifiedMemoryReuseCleanerThread = Thread::create(cleanUnifiedMemoryReuse, reinterpret_cast<void *>(this));
+}
+
+UnifiedMemoryReuseCleaner::~UnifiedMemoryReuseCleaner() {
+    keepCleaning.store(false);
+    if (unifiedMemoryReuseCleanerThread) {
+        unifiedMemoryReuseCleanerThread->join();
+        unifiedMemoryReuseCleanerThread.reset();
+    }
+}
+
+void UnifiedMemoryReuseCleaner::registerSvmAllocationCache(SVMAllocsManager::SvmAllocationCache *cache) {
+    std::lock_guard<std::mutex> lock(svmAllocationCachesMutex);
+    svmAllocationCaches.push_back(cache);
+}
+
+void UnifiedMemoryReuseCleaner::unregisterSvmAllocationCache(SVMAllocsManager::SvmAllocationCache *cache) {
+    std::lock_guard<std::mutex> lock(svmAllocationCachesMutex);
+    svmAllocationCaches.erase(std::remove(svmAllocationCaches.begin(), svmAllocationCaches.end(), cache), svmAllocationCaches.end());
+}
+
+void *UnifiedMemoryReuseCleaner::cleanUnifiedMemoryReuse(void *self) {
+    auto cleaner = reinterpret_cast<UnifiedMemoryReuseCleaner *>(self);
+    while (cleaner->keepCleaning.load()) {
+        cleaner->sleep();
+        cleaner->trimOldInCaches();
+    }
+    return nullptr;
+}
+
+void UnifiedMemoryReuseCleaner::trimOldInCaches() {
+    std::lock_guard<std::mutex> lock(svmAllocationCachesMutex);
+    const auto now = this->getCpuTimestamp();
+    for (auto cache : svmAllocationCaches) {
+        cache->trimOldAllocs(now);
+    }
+}
+
+void UnifiedMemoryReuseCleaner::sleep() {
+    std::this_thread::sleep_for(sleepTime);
+}
+
+std::chrono::steady_clock::time_point UnifiedMemoryReuseCleaner::getCpuTimestamp() {
+    return std::chrono::steady_clock::now();
+}
+
+} // namespace NEO
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/memory_manager/unified_memory_manager.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Background thread releasing allocations kept for too long in USM reuse caches (see SvmAllocationCache::maxAge).
+class UnifiedMemoryReuseCleaner {
+  public:
+    static constexpr auto sleepTime = std::chrono::milliseconds(15u);
+    UnifiedMemoryReuseCleaner();
+    virtual ~UnifiedMemoryReuseCleaner();
+
+    void registerSvmAllocationCache(SVMAllocsManager::SvmAllocationCache *cache);
+    void unregisterSvmAllocationCache(SVMAllocsManager::SvmAllocationCache *cache);
+
+  protected:
+    static void *cleanUnifiedMemoryReuse(void *self);
+    void trimOldInCaches();
+    MOCKABLE_VIRTUAL void sleep();
+    MOCKABLE_VIRTUAL std::chrono::steady_clock::time_point getCpuTimestamp();
+
+    std::unique_ptr<Thread> unifiedMemoryReuseCleanerThread;
+    std::vector<SVMAllocsManager::SvmAllocationCache *> svmAllocationCaches;
+    std::mutex svmAllocationCachesMutex;
+    std::atomic_bool keepCleaning = true;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -91,14 +91,11 @@ BufferObject::BufferObject(uint32_t rootDeviceIndex, Drm *drm, uint64_t patIndex
     perContextVmsUsed = drm->isPerContextVMRequired();
     requiresExplicitResidency = drm->hasPageFaultSupport();
 
-    if (perContextVmsUsed) {
-        bindInfo.resize(maxOsContextCount);
-        for (auto &iter : bindInfo) {
-            iter.fill(false);
+    bindInfo = std::vector<std::array<std::atomic<bool>, EngineLimits::maxHandleCount>>(perContextVmsUsed ? maxOsContextCount : 1u);
+    for (auto &iter : bindInfo) {
+        for (auto &bound : iter) {
+            bound = false;
         }
-    } else {
-        bindInfo.resize(1);
-        bindInfo[0].fill(false);
     }
 }
 
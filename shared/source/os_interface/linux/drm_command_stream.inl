@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -84,6 +84,11 @@ inline DrmCommandStreamReceiver<GfxFamily>::~DrmCommandStreamReceiver() {
     if (this->isUpdateTagFromWaitEnabled()) {
         this->waitForCompletionWithTimeout(WaitParams{false, false, 0}, this->peekTaskCount());
     }
+    if (this->gemCloseWorkerOperationMode == GemCloseWorkerMode::gemCloseWorkerActive && DrmGemCloseWorker::isBatchingEnabled()) {
+        if (auto gemCloseWorker = this->getMemoryManager()->peekGemCloseWorker()) {
+            gemCloseWorker->drainAsync();
+        }
+    }
 }
 
 template <typename GfxFamily>
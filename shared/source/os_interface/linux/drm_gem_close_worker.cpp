@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_command_stream.h"
@@ -20,6 +21,13 @@
 namespace NEO {
 
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
+    batchingEnabled = isBatchingEnabled();
+    if (debugManager.flags.GemCloseWorkerBatchSize.get() > 0) {
+        batchSize = static_cast<uint32_t>(debugManager.flags.GemCloseWorkerBatchSize.get());
+    }
+    if (debugManager.flags.GemCloseWorkerMaxPendingBufferObjects.get() > 0) {
+        maxPendingBufferObjects = static_cast<uint32_t>(debugManager.flags.GemCloseWorkerMaxPendingBufferObjects.get());
+    }
     thread = Thread::create(worker, reinterpret_cast<void *>(this));
 }
 
@@ -39,7 +47,15 @@ DrmGemCloseWorker::~DrmGemCloseWorker() {
     closeThread();
 }
 
+bool DrmGemCloseWorker::isBatchingEnabled() {
+    return debugManager.flags.EnableBatchedGemCloseWorker.get() == 1;
+}
+
 void DrmGemCloseWorker::push(BufferObject *bo) {
+    if (batchingEnabled) {
+        pushBatched(bo);
+        return;
+    }
     std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
     queue.push(bo);
@@ -55,6 +71,41 @@ void DrmGemCloseWorker::close(bool blocking) {
     }
 }
 
+void DrmGemCloseWorker::drainAsync() {
+    if (batchingEnabled) {
+        drainRequested = true;
+    }
+    notifyWorker();
+}
+
+void DrmGemCloseWorker::notifyWorker() {
+    // worker evaluates its wait predicate under the mutex, taking it here ensures the wakeup is not lost
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    lock.unlock();
+    condition.notify_one();
+}
+
+void DrmGemCloseWorker::pushBatched(BufferObject *bo) {
+    if (workCount.load() >= maxPendingBufferObjects) {
+        // back-pressure - worker is too far behind, close in calling thread instead of growing the list
+        bo->wait(-1);
+        memoryManager.unreference(bo, false);
+        return;
+    }
+
+    auto pendingCount = ++workCount;
+    auto workItem = new BatchedWorkItem{bo, nullptr};
+    // work item may be processed and deleted by worker as soon as it is published, do not access it after successful CAS
+    BatchedWorkItem *head = pendingWorkItems.load(std::memory_order_relaxed);
+    do {
+        workItem->next = head;
+    } while (!pendingWorkItems.compare_exchange_weak(head, workItem, std::memory_order_release, std::memory_order_relaxed));
+
+    if (head == nullptr || pendingCount == batchSize) {
+        notifyWorker();
+    }
+}
+
 bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
@@ -74,8 +125,47 @@ inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQue
     }
 }
 
+void DrmGemCloseWorker::processBatch(BatchedWorkItem *batch) {
+    BatchedWorkItem *fifoBatch = nullptr;
+    while (batch != nullptr) {
+        auto next = batch->next;
+        batch->next = fifoBatch;
+        fifoBatch = batch;
+        batch = next;
+    }
+
+    while (fifoBatch != nullptr) {
+        auto next = fifoBatch->next;
+        close(fifoBatch->bo);
+        delete fifoBatch;
+        fifoBatch = next;
+    }
+}
+
+void DrmGemCloseWorker::batchedWorkerLoop() {
+    while (active) {
+        std::unique_lock<std::mutex> lock(closeWorkerMutex);
+        condition.wait(lock, [this] { return !active || drainRequested || pendingWorkItems.load() != nullptr; });
+
+        // give producers a moment to fill the batch unless it is already full or drain was requested
+        condition.wait_for(lock, batchTimeout, [this] { return !active || drainRequested || workCount.load() >= batchSize; });
+        drainRequested = false;
+        lock.unlock();
+
+        processBatch(pendingWorkItems.exchange(nullptr, std::memory_order_acquire));
+    }
+
+    processBatch(pendingWorkItems.exchange(nullptr, std::memory_order_acquire));
+}
+
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
+    if (self->batchingEnabled) {
+        self->batchedWorkerLoop();
+        self->workerDone.store(true);
+        return nullptr;
+    }
+
     std::queue<BufferObject *> localQueue;
     std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
     lock.unlock();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <map>
@@ -34,13 +35,30 @@ class DrmGemCloseWorker {
 
     void push(BufferObject *allocation);
     MOCKABLE_VIRTUAL void close(bool blocking);
+    void drainAsync();
 
     bool isEmpty();
 
+    static bool isBatchingEnabled();
+
+    static constexpr uint32_t defaultBatchSize = 64u;
+    static constexpr uint32_t defaultMaxPendingBufferObjects = 16384u;
+    static constexpr std::chrono::milliseconds batchTimeout{1};
+
   protected:
+    // Node of lock-free multi-producer single-consumer list used in batched mode
+    struct BatchedWorkItem {
+        BufferObject *bo;
+        BatchedWorkItem *next;
+    };
+
     void close(BufferObject *workItem);
     void closeThread();
     void processQueue(std::queue<BufferObject *> &inputQueue);
+    void pushBatched(BufferObject *bo);
+    void processBatch(BatchedWorkItem *batch);
+    void notifyWorker();
+    void batchedWorkerLoop();
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
@@ -54,5 +72,11 @@ class DrmGemCloseWorker {
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
     std::atomic<bool> workerDone{false};
+
+    std::atomic<BatchedWorkItem *> pendingWorkItems{nullptr};
+    std::atomic<bool> drainRequested{false};
+    uint32_t batchSize = defaultBatchSize;
+    uint32_t maxPendingBufferObjects = defaultMaxPendingBufferObjects;
+    bool batchingEnabled = false;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,10 +17,34 @@
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include <algorithm>
+
 namespace NEO {
 
+namespace {
+// Residency shard held by current thread while making allocations resident.
+// Eviction requested by a failed bind at that time (see Drm::bindBufferObject) is limited to this shard,
+// other shards may be held by threads waiting for the one it holds.
+struct LockedResidencyShard {
+    const DrmMemoryOperationsHandlerBind *handler = nullptr;
+    uint32_t shardIndex = 0u;
+};
+thread_local LockedResidencyShard lockedResidencyShard;
+
+struct LockedResidencyShardScope {
+    LockedResidencyShardScope(const DrmMemoryOperationsHandlerBind *handler, uint32_t shardIndex) : previous(lockedResidencyShard) {
+        lockedResidencyShard = {handler, shardIndex};
+    }
+    ~LockedResidencyShardScope() {
+        lockedResidencyShard = previous;
+    }
+    LockedResidencyShard previous;
+};
+} // namespace
+
 DrmMemoryOperationsHandlerBind::DrmMemoryOperationsHandlerBind(const RootDeviceEnvironment &rootDeviceEnvironment, uint32_t rootDeviceIndex)
     : DrmMemoryOperationsHandler(rootDeviceIndex), rootDeviceEnvironment(rootDeviceEnvironment){};
 
@@ -41,8 +65,10 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResident(Device *devi
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContext(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
     auto deviceBitfield = osContext->getDeviceBitfield();
+    const bool batchedBind = isBatchedBindEnabled();
+    const bool residencyShardLocking = isResidencyShardLockingEnabled();
 
-    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<BufferObject *> bosToBind;
     auto devicesDone = 0u;
     for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
         if (!deviceBitfield.test(drmIterator)) {
@@ -50,30 +76,130 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
         }
         devicesDone++;
 
+        // nothing is changed for evictable allocations already bound, so only they skip the lock;
+        // marking allocations as always resident must not interleave with eviction of unused allocations
+        if (residencyShardLocking && evictable && areAllocationsBound(osContext, gfxAllocations, drmIterator)) {
+            continue;
+        }
+
+        const auto shardIndex = getResidencyShardIndex(osContext, drmIterator);
+        std::lock_guard<std::mutex> lock(residencyShardMutexes[shardIndex]);
+        LockedResidencyShardScope lockedShardScope(this, shardIndex);
+
+        bosToBind.clear();
         for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
             auto drmAllocation = static_cast<DrmAllocation *>(*gfxAllocation);
-            auto bo = drmAllocation->storageInfo.getNumBanks() > 1 ? drmAllocation->getBOs()[drmIterator] : drmAllocation->getBO();
-
-            if (drmAllocation->storageInfo.isChunked) {
-                bo = drmAllocation->getBO();
-            }
+            auto bo = getBoForBindingState(drmAllocation, drmIterator);
 
             if (!bo->bindInfo[bo->getOsContextId(osContext)][drmIterator]) {
-                int result = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true);
+                // fragments track their residency per fragment, they are bound right away
+                auto collectBOs = batchedBind && drmAllocation->fragmentsStorage.fragmentCount == 0;
+                int result = drmAllocation->makeBOsResident(osContext, drmIterator, collectBOs ? &bosToBind : nullptr, true);
                 if (result) {
                     return MemoryOperationsStatus::outOfMemory;
                 }
             }
 
-            if (!evictable) {
+            if (!evictable && !batchedBind) {
                 drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
             }
         }
+
+        if (!bosToBind.empty()) {
+            std::sort(bosToBind.begin(), bosToBind.end());
+            bosToBind.erase(std::unique(bosToBind.begin(), bosToBind.end()), bosToBind.end());
+
+            auto drm = bosToBind[0]->peekDrm();
+            int result = drm->bindBufferObjects(osContext, drmIterator, ArrayRef<BufferObject *>(bosToBind));
+            if (result) {
+                return MemoryOperationsStatus::outOfMemory;
+            }
+        }
+
+        if (!evictable && batchedBind) {
+            for (auto &gfxAllocation : gfxAllocations) {
+                gfxAllocation->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
+            }
+        }
     }
 
     return MemoryOperationsStatus::success;
 }
 
+BufferObject *DrmMemoryOperationsHandlerBind::getBoForBindingState(DrmAllocation *drmAllocation, uint32_t vmHandleId) {
+    if (drmAllocation->storageInfo.isChunked) {
+        return drmAllocation->getBO();
+    }
+    return drmAllocation->storageInfo.getNumBanks() > 1 ? drmAllocation->getBOs()[vmHandleId] : drmAllocation->getBO();
+}
+
+bool DrmMemoryOperationsHandlerBind::areAllocationsBound(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, uint32_t vmHandleId) {
+    for (auto &gfxAllocation : gfxAllocations) {
+        auto drmAllocation = static_cast<DrmAllocation *>(gfxAllocation);
+        if (drmAllocation->fragmentsStorage.fragmentCount > 0) {
+            return false;
+        }
+        auto bo = getBoForBindingState(drmAllocation, vmHandleId);
+        if (!bo->bindInfo[bo->getOsContextId(osContext)][vmHandleId]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DrmMemoryOperationsHandlerBind::isPerContextVmUsed() const {
+    auto osInterface = this->rootDeviceEnvironment.osInterface.get();
+    return osInterface && osInterface->getDriverModel()->as<Drm>()->isPerContextVMRequired();
+}
+
+uint32_t DrmMemoryOperationsHandlerBind::getResidencyShardIndex(OsContext *osContext, uint32_t vmHandleId) const {
+    if (!isResidencyShardLockingEnabled()) {
+        return 0u;
+    }
+    // OS contexts share VM of a tile unless per context VMs are used
+    auto vmContextId = isPerContextVmUsed() ? osContext->getContextId() : 0u;
+    return (vmContextId * EngineLimits::maxHandleCount + vmHandleId) % residencyShardsCount;
+}
+
+std::vector<std::unique_lock<std::mutex>> DrmMemoryOperationsHandlerBind::lockResidencyShards(OsContext *osContext, DeviceBitfield deviceBitfield) {
+    std::array<bool, residencyShardsCount> shardsToLock{};
+    for (auto vmHandleId = 0u; vmHandleId < deviceBitfield.size(); vmHandleId++) {
+        if (deviceBitfield.test(vmHandleId)) {
+            shardsToLock[getResidencyShardIndex(osContext, vmHandleId)] = true;
+        }
+    }
+
+    // shards are always locked in ascending order
+    std::vector<std::unique_lock<std::mutex>> locks;
+    for (auto shardIndex = 0u; shardIndex < residencyShardsCount; shardIndex++) {
+        if (shardsToLock[shardIndex]) {
+            locks.emplace_back(residencyShardMutexes[shardIndex]);
+        }
+    }
+    return locks;
+}
+
+std::vector<std::unique_lock<std::mutex>> DrmMemoryOperationsHandlerBind::lockAllResidencyShards() {
+    std::vector<std::unique_lock<std::mutex>> locks;
+    if (!isResidencyShardLockingEnabled()) {
+        locks.emplace_back(residencyShardMutexes[0]);
+        return locks;
+    }
+    locks.reserve(residencyShardsCount);
+    for (auto &shardMutex : residencyShardMutexes) {
+        locks.emplace_back(shardMutex);
+    }
+    return locks;
+}
+
+bool DrmMemoryOperationsHandlerBind::isBatchedBindEnabled() {
+    return debugManager.flags.EnableBatchedVmBind.get() == 1;
+}
+
+bool DrmMemoryOperationsHandlerBind::isResidencyShardLockingEnabled() {
+    return debugManager.flags.EnableResidencyShardLocking.get() == 1;
+}
+
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evict(Device *device, GraphicsAllocation &gfxAllocation) {
     auto &engines = device->getAllEngines();
     auto retVal = MemoryOperationsStatus::success;
@@ -87,7 +213,7 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evict(Device *device, Gra
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictWithinOsContext(OsContext *osContext, GraphicsAllocation &gfxAllocation) {
-    std::lock_guard<std::mutex> lock(mutex);
+    auto locks = lockResidencyShards(osContext, osContext->getDeviceBitfield());
     int retVal = evictImpl(osContext, gfxAllocation, osContext->getDeviceBitfield());
     if (retVal) {
         return MemoryOperationsStatus::failed;
@@ -111,7 +237,7 @@ int DrmMemoryOperationsHandlerBind::evictImpl(OsContext *osContext, GraphicsAllo
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::isResident(Device *device, GraphicsAllocation &gfxAllocation) {
-    std::lock_guard<std::mutex> lock(mutex);
+    auto locks = lockAllResidencyShards();
     bool isResident = true;
     auto &engines = device->getAllEngines();
     for (const auto &engine : engines) {
@@ -148,16 +274,19 @@ std::unique_lock<std::mutex> DrmMemoryOperationsHandlerBind::lockHandlerIfUsed()
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) {
     auto memoryManager = static_cast<DrmMemoryManager *>(this->rootDeviceEnvironment.executionEnvironment.memoryManager.get());
 
-    std::unique_lock<std::mutex> evictLock(mutex, std::defer_lock);
+    std::vector<std::unique_lock<std::mutex>> evictLocks;
+    std::optional<uint32_t> shardIndex;
     if (isLockNeeded) {
-        evictLock.lock();
+        evictLocks = lockAllResidencyShards();
+    } else if (lockedResidencyShard.handler == this) {
+        shardIndex = lockedResidencyShard.shardIndex;
     }
 
     auto allocLock = memoryManager->acquireAllocLock();
 
     for (const auto status : {
-             this->evictUnusedAllocationsImpl(memoryManager->getSysMemAllocs(), waitForCompletion),
-             this->evictUnusedAllocationsImpl(memoryManager->getLocalMemAllocs(this->rootDeviceIndex), waitForCompletion)}) {
+             this->evictUnusedAllocationsImpl(memoryManager->getSysMemAllocs(), waitForCompletion, shardIndex),
+             this->evictUnusedAllocationsImpl(memoryManager->getLocalMemAllocs(this->rootDeviceIndex), waitForCompletion, shardIndex)}) {
 
         if (status == MemoryOperationsStatus::gpuHangDetectedDuringOperation) {
             return MemoryOperationsStatus::gpuHangDetectedDuringOperation;
@@ -167,7 +296,7 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bo
     return MemoryOperationsStatus::success;
 }
 
-MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion) {
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion, std::optional<uint32_t> shardIndex) {
     const auto &engines = this->rootDeviceEnvironment.executionEnvironment.memoryManager->getRegisteredEngines(this->rootDeviceIndex);
     std::vector<GraphicsAllocation *> evictCandidates;
 
@@ -207,6 +336,9 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
 
         for (auto &allocationToEvict : evictCandidates) {
             for (const auto &engine : engines) {
+                if (shardIndex && getResidencyShardIndex(engine.osContext, subdeviceIndex) != *shardIndex) {
+                    continue;
+                }
                 if (engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
                     DeviceBitfield deviceBitfield;
                     deviceBitfield.set(subdeviceIndex);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,10 +9,22 @@
 #include "shared/source/helpers/device_bitfield.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 
+#include <array>
+#include <optional>
+#include <vector>
+
 namespace NEO {
+class BufferObject;
+class DrmAllocation;
 struct RootDeviceEnvironment;
+
+// Bindings of buffer objects are tracked per VM, so with EnableResidencyShardLocking residency operations
+// lock only the shard of VM they change instead of a single lock. Evictable allocations already bound within VM
+// are then made resident without locking. Otherwise all operations use the first shard.
 class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
   public:
+    static constexpr uint32_t residencyShardsCount = 16u;
+
     DrmMemoryOperationsHandlerBind(const RootDeviceEnvironment &rootDeviceEnvironment, uint32_t rootDeviceIndex);
     ~DrmMemoryOperationsHandlerBind() override;
 
@@ -27,9 +39,21 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
 
     MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) override;
 
+    static bool isBatchedBindEnabled();
+    static bool isResidencyShardLockingEnabled();
+    uint32_t getResidencyShardIndex(OsContext *osContext, uint32_t vmHandleId) const;
+
   protected:
     MOCKABLE_VIRTUAL int evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield);
-    MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion);
+    MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion, std::optional<uint32_t> shardIndex);
+
+    static BufferObject *getBoForBindingState(DrmAllocation *drmAllocation, uint32_t vmHandleId);
+    static bool areAllocationsBound(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, uint32_t vmHandleId);
+    bool isPerContextVmUsed() const;
+    std::vector<std::unique_lock<std::mutex>> lockResidencyShards(OsContext *osContext, DeviceBitfield deviceBitfield);
+    std::vector<std::unique_lock<std::mutex>> lockAllResidencyShards();
+
     const RootDeviceEnvironment &rootDeviceEnvironment;
+    std::array<std::mutex, residencyShardsCount> residencyShardMutexes;
 };
 } // namespace NEO
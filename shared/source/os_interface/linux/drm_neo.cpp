@@ -871,6 +871,24 @@ bool Drm::getDeviceMemoryPhysicalSizeInBytes(uint32_t tileId, uint64_t &physical
     return true;
 }
 
+bool Drm::getDeviceNumaNode(int &numaNode) {
+    const std::string relativefilePath = "/device/numa_node";
+    std::string readString(64, '\0');
+    errno = 0;
+    if (readSysFsAsString(relativefilePath, readString) == false) {
+        return false;
+    }
+
+    char *endPtr = nullptr;
+    auto retNode = static_cast<int>(std::strtol(readString.data(), &endPtr, 10));
+    // numa_node is -1 when the platform does not report device locality
+    if ((endPtr == readString.data()) || (errno != 0) || (retNode < 0)) {
+        return false;
+    }
+    numaNode = retNode;
+    return true;
+}
+
 bool Drm::useVMBindImmediate() const {
     bool useBindImmediate = isDirectSubmissionActive() || hasPageFaultSupport() || ioctlHelper->isImmediateVmBindRequired();
 
@@ -950,6 +968,12 @@ std::vector<uint64_t> Drm::getMemoryRegions() {
 
 bool Drm::queryMemoryInfo() {
     this->memoryInfo = ioctlHelper->createMemoryInfo();
+    if (this->memoryInfo) {
+        int numaNode = debugManager.flags.OverrideHostAllocationNumaNode.get();
+        if (numaNode != -1 || (debugManager.flags.EnableGpuLocalHostAllocationPlacement.get() == 1 && getDeviceNumaNode(numaNode))) {
+            this->memoryInfo->setHostAllocationNumaNode(numaNode);
+        }
+    }
     return this->memoryInfo != nullptr;
 }
 
@@ -1246,7 +1270,7 @@ uint64_t Drm::getPatIndex(Gmm *gmm, AllocationType allocationType, CacheRegion c
     return patIndex;
 }
 
-int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleId, BufferObject *bo, bool bind) {
+int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleId, BufferObject *bo, bool bind, bool userFenceAllowed) {
     auto vmId = drm->getVirtualMemoryAddressSpace(vmHandleId);
     auto ioctlHelper = drm->getIoctlHelper();
 
@@ -1316,7 +1340,7 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
             if (drm->useVMBindImmediate()) {
                 lock = drm->lockBindFenceMutex();
 
-                if (!drm->hasPageFaultSupport() || bo->isExplicitResidencyRequired()) {
+                if (userFenceAllowed && (!drm->hasPageFaultSupport() || bo->isExplicitResidencyRequired())) {
                     auto nextExtension = vmBind.extensions;
 
                     uint64_t address = 0;
@@ -1365,16 +1389,74 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
 }
 
 int Drm::bindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo) {
-    auto ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, true);
+    auto ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, true, true);
     if (ret != 0) {
         static_cast<DrmMemoryOperationsHandlerBind *>(this->rootDeviceEnvironment.memoryOperationsInterface.get())->evictUnusedAllocations(false, false);
-        ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, true);
+        ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, true, true);
     }
     return ret;
 }
 
+bool Drm::isUserFenceRequiredForBind(BufferObject *bo) {
+    return ioctlHelper->isWaitBeforeBindRequired(true) && useVMBindImmediate() && (!hasPageFaultSupport() || bo->isExplicitResidencyRequired());
+}
+
+int Drm::bindBufferObjects(OsContext *osContext, uint32_t vmHandleId, ArrayRef<BufferObject *> bufferObjects) {
+    // Binds to a VM complete in submission order, so user fence attached to the last bind requiring it
+    // signals completion of the whole batch - paging fence is advanced once instead of once per buffer object
+    auto fencedBindIndex = bufferObjects.size();
+    for (auto i = 0u; i < bufferObjects.size(); i++) {
+        auto bo = bufferObjects[i];
+        if (!bo->bindInfo[bo->getOsContextId(osContext)][vmHandleId] && isUserFenceRequiredForBind(bo)) {
+            fencedBindIndex = i;
+        }
+    }
+
+    std::vector<BufferObject *> boundBufferObjects;
+    boundBufferObjects.reserve(bufferObjects.size());
+    for (auto i = 0u; i < bufferObjects.size(); i++) {
+        auto bo = bufferObjects[i];
+        auto contextId = bo->getOsContextId(osContext);
+        if (bo->bindInfo[contextId][vmHandleId]) {
+            continue;
+        }
+
+        auto ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, true, i == fencedBindIndex);
+        if (ret != 0) {
+            static_cast<DrmMemoryOperationsHandlerBind *>(this->rootDeviceEnvironment.memoryOperationsInterface.get())->evictUnusedAllocations(false, false);
+            ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, true, true);
+        }
+        if (debugManager.flags.PrintBOBindingResult.get()) {
+            bo->printBOBindingResult(osContext, vmHandleId, true, ret);
+        }
+        if (ret != 0) {
+            // binds done so far may not be covered by a user fence, roll them back so none is left marked as bound
+            unbindBufferObjects(osContext, vmHandleId, ArrayRef<BufferObject *>(boundBufferObjects));
+            return ret;
+        }
+        bo->bindInfo[contextId][vmHandleId] = true;
+        boundBufferObjects.push_back(bo);
+    }
+    return 0;
+}
+
+void Drm::unbindBufferObjects(OsContext *osContext, uint32_t vmHandleId, ArrayRef<BufferObject *> bufferObjects) {
+    for (auto bo : bufferObjects) {
+        auto contextId = bo->getOsContextId(osContext);
+        // eviction requested by a failed bind may have unbound it already
+        if (!bo->bindInfo[contextId][vmHandleId]) {
+            continue;
+        }
+        auto ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, false, true);
+        if (debugManager.flags.PrintBOBindingResult.get()) {
+            bo->printBOBindingResult(osContext, vmHandleId, false, ret);
+        }
+        bo->bindInfo[contextId][vmHandleId] = false;
+    }
+}
+
 int Drm::unbindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo) {
-    return changeBufferObjectBinding(this, osContext, vmHandleId, bo, false);
+    return changeBufferObjectBinding(this, osContext, vmHandleId, bo, false, true);
 }
 
 int Drm::createDrmVirtualMemory(uint32_t &drmVmId) {
@@ -14,6 +14,7 @@
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "igfxfmid.h"
@@ -122,6 +123,9 @@ class Drm : public DriverModel {
     uint32_t getVirtualMemoryAddressSpace(uint32_t vmId) const;
     MOCKABLE_VIRTUAL int bindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo);
     MOCKABLE_VIRTUAL int unbindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo);
+    MOCKABLE_VIRTUAL int bindBufferObjects(OsContext *osContext, uint32_t vmHandleId, ArrayRef<BufferObject *> bufferObjects);
+    void unbindBufferObjects(OsContext *osContext, uint32_t vmHandleId, ArrayRef<BufferObject *> bufferObjects);
+    bool isUserFenceRequiredForBind(BufferObject *bo);
     int setupHardwareInfo(const DeviceDescriptor *, bool);
     void setupSystemInfo(HardwareInfo *hwInfo, SystemInfo *sysInfo);
     void setupCacheInfo(const HardwareInfo &hwInfo);
@@ -248,6 +252,7 @@ class Drm : public DriverModel {
     bool isVmBindPatIndexProgrammingSupported() const { return vmBindPatIndexProgrammingSupported; }
     MOCKABLE_VIRTUAL bool getDeviceMemoryMaxClockRateInMhz(uint32_t tileId, uint32_t &clkRate);
     MOCKABLE_VIRTUAL bool getDeviceMemoryPhysicalSizeInBytes(uint32_t tileId, uint64_t &physicalSize);
+    MOCKABLE_VIRTUAL bool getDeviceNumaNode(int &numaNode);
     void cleanup() override;
     bool readSysFsAsString(const std::string &relativeFilePath, std::string &readString);
     MOCKABLE_VIRTUAL std::string getSysFsPciPath();
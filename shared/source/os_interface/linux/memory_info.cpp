@@ -66,6 +66,19 @@ void MemoryInfo::assignRegionsFromDistances(const std::vector<DistanceInfo> &dis
 int MemoryInfo::createGemExt(const MemRegionsVec &memClassInstances, size_t allocSize, uint32_t &handle, uint64_t patIndex, std::optional<uint32_t> vmId, int32_t pairHandle, bool isChunked, uint32_t numOfChunks, bool isUSMHostAllocation) {
     std::vector<unsigned long> memPolicyNodeMask;
     int mode = -1;
+    bool systemMemoryOnly = (memClassInstances.size() == 1u) && (memClassInstances[0].memoryClass == systemMemoryRegion.region.memoryClass);
+    if (memPolicySupported && hostAllocationNumaNode != -1 && (isUSMHostAllocation || systemMemoryOnly)) {
+        // host allocations, staging and command buffers prefer the node the GPU is attached to,
+        // kernel falls back to other nodes when it is full
+        // only prelim i915 ioctl helper passes memory policy to kernel, upstream i915 and xe helpers ignore it
+        constexpr int mpolPreferred = 1;
+        constexpr size_t bitsPerNodeMaskEntry = sizeof(unsigned long) * 8;
+        auto numaNode = static_cast<size_t>(hostAllocationNumaNode);
+        memPolicyNodeMask.resize(numaNode / bitsPerNodeMaskEntry + 1, 0u);
+        memPolicyNodeMask[numaNode / bitsPerNodeMaskEntry] = 1ul << (numaNode % bitsPerNodeMaskEntry);
+        mode = (memPolicyMode != -1) ? memPolicyMode : mpolPreferred;
+        return this->drm.getIoctlHelper()->createGemExt(memClassInstances, allocSize, handle, patIndex, vmId, pairHandle, isChunked, numOfChunks, mode, memPolicyNodeMask);
+    }
     if (memPolicySupported &&
         isUSMHostAllocation &&
         Linux::NumaLibrary::getMemPolicy(&mode, memPolicyNodeMask)) {
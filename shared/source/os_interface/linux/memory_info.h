@@ -44,6 +44,8 @@ class MemoryInfo {
 
     const RegionContainer &getDrmRegionInfos() const { return drmQueryRegions; }
     bool isMemPolicySupported() const { return memPolicySupported; }
+    void setHostAllocationNumaNode(int numaNode) { hostAllocationNumaNode = numaNode; }
+    int getHostAllocationNumaNode() const { return hostAllocationNumaNode; }
 
   protected:
     const Drm &drm;
@@ -52,6 +54,7 @@ class MemoryInfo {
     const MemoryRegion &systemMemoryRegion;
     bool memPolicySupported;
     int memPolicyMode;
+    int hostAllocationNumaNode = -1;
     RegionContainer localMemoryRegions;
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,9 +16,13 @@ DeferrableDeletion *DeferrableDeletion::create(Args... args) {
     return new DeferrableDeletionImpl(std::forward<Args>(args)...);
 }
 template DeferrableDeletion *DeferrableDeletion::create(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle);
+template DeferrableDeletion *DeferrableDeletion::create(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle, size_t size, bool externalHandle);
 
 DeferrableDeletionImpl::DeferrableDeletionImpl(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle)
-    : wddm(wddm), allocationCount(allocationCount), resourceHandle(resourceHandle) {
+    : DeferrableDeletionImpl(wddm, handles, allocationCount, resourceHandle, 0u, false) {}
+
+DeferrableDeletionImpl::DeferrableDeletionImpl(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle, size_t size, bool externalHandle)
+    : wddm(wddm), allocationCount(allocationCount), resourceHandle(resourceHandle), size(size), externalHandle(externalHandle) {
     if (handles) {
         this->handles = new D3DKMT_HANDLE[allocationCount];
         for (uint32_t i = 0; i < allocationCount; i++) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,7 +19,10 @@ class Wddm;
 class DeferrableDeletionImpl : public DeferrableDeletion {
   public:
     DeferrableDeletionImpl(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle);
+    DeferrableDeletionImpl(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle, size_t size, bool externalHandle);
     bool apply() override;
+    size_t getSize() const override { return size; }
+    bool isExternalHandle() const override { return externalHandle; }
     ~DeferrableDeletionImpl() override;
 
     DeferrableDeletionImpl(const DeferrableDeletionImpl &) = delete;
@@ -30,5 +33,7 @@ class DeferrableDeletionImpl : public DeferrableDeletion {
     D3DKMT_HANDLE *handles = nullptr;
     uint32_t allocationCount;
     D3DKMT_HANDLE resourceHandle;
+    size_t size = 0u;
+    bool externalHandle = false;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,8 +8,11 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/spinlock.h"
 
@@ -20,8 +23,17 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::cpu : AllocationDomain::none;
 
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain, 0u, {}};
+    if (isRangeMigrationEnabled()) {
+        const auto rangeSize = getMigrationRangeSize();
+        if (size > rangeSize) {
+            pageFaultData.rangeSize = rangeSize;
+            pageFaultData.rangeDomains.assign(Math::divideAndRoundUp(size, rangeSize), domain);
+        }
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -36,6 +48,10 @@ void PageFaultManager::removeAllocation(void *ptr) {
         if (pageFaultData.domain == AllocationDomain::gpu) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         } else {
+            if (!pageFaultData.rangeDomains.empty()) {
+                // ranges not touched by CPU are still protected
+                allowCPUMemoryAccess(ptr, pageFaultData.size);
+            }
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
@@ -80,18 +96,51 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
         if (this->checkFaultHandlerFromPageFaultManager() == false) {
             this->registerFaultHandler();
         }
+        size_t transferredSize = pageFaultData.size;
         start = std::chrono::steady_clock::now();
-        this->transferToGpu(ptr, pageFaultData.cmdQ);
+        if (pageFaultData.rangeDomains.empty()) {
+            this->transferToGpu(ptr, pageFaultData.cmdQ);
+        } else {
+            transferredSize = this->migrateRangesToGpuDomain(ptr, pageFaultData);
+        }
         end = std::chrono::steady_clock::now();
         long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
         if (debugManager.flags.PrintUmdSharedMigration.get()) {
-            printf("UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
+            printf("UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), transferredSize, elapsedTime / 1e3);
         }
 
-        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+        if (pageFaultData.rangeDomains.empty()) {
+            this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+        }
     }
     pageFaultData.domain = AllocationDomain::gpu;
+    std::fill(pageFaultData.rangeDomains.begin(), pageFaultData.rangeDomains.end(), AllocationDomain::gpu);
+}
+
+size_t PageFaultManager::migrateRangesToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    size_t transferredSize = 0u;
+    const auto rangesCount = pageFaultData.rangeDomains.size();
+    size_t rangeIndex = 0u;
+    while (rangeIndex < rangesCount) {
+        if (pageFaultData.rangeDomains[rangeIndex] != AllocationDomain::cpu) {
+            rangeIndex++;
+            continue;
+        }
+        // adjacent ranges touched by CPU are transferred with a single copy
+        auto endRangeIndex = rangeIndex + 1;
+        while (endRangeIndex < rangesCount && pageFaultData.rangeDomains[endRangeIndex] == AllocationDomain::cpu) {
+            endRangeIndex++;
+        }
+        const size_t offset = rangeIndex * pageFaultData.rangeSize;
+        const size_t size = std::min(endRangeIndex * pageFaultData.rangeSize, pageFaultData.size) - offset;
+
+        this->transferRangeToGpu(ptr, offset, size, pageFaultData.cmdQ);
+        this->protectCPUMemoryAccess(ptrOffset(ptr, offset), size);
+        transferredSize += size;
+        rangeIndex = endRangeIndex;
+    }
+    return transferredSize;
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
@@ -101,7 +150,11 @@ bool PageFaultManager::verifyPageFault(void *ptr) {
         auto &pageFaultData = alloc.second;
         if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
             this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
+            if (pageFaultData.rangeDomains.empty()) {
+                gpuDomainHandler(this, allocPtr, pageFaultData);
+            } else {
+                this->migrateRangeToCpuDomain(allocPtr, pageFaultData, ptrDiff(ptr, allocPtr) / pageFaultData.rangeSize);
+            }
             return true;
         }
     }
@@ -142,6 +195,54 @@ inline void PageFaultManager::migrateStorageToCpuDomain(void *ptr, PageFaultData
     pageFaultData.domain = AllocationDomain::cpu;
 }
 
+void PageFaultManager::migrateRangeToCpuDomain(void *ptr, PageFaultData &pageFaultData, size_t rangeIndex) {
+    const size_t offset = rangeIndex * pageFaultData.rangeSize;
+    const size_t size = std::min(pageFaultData.rangeSize, pageFaultData.size - offset);
+    auto rangePtr = ptrOffset(ptr, offset);
+    const bool unprotectBeforeTransfer = (this->gpuDomainHandler == &PageFaultManager::unprotectAndTransferMemory);
+
+    if (unprotectBeforeTransfer) {
+        this->allowCPUMemoryAccess(rangePtr, size);
+    }
+    if (pageFaultData.rangeDomains[rangeIndex] == AllocationDomain::gpu) {
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+
+        start = std::chrono::steady_clock::now();
+        this->transferRangeToCpu(ptr, offset, size, pageFaultData.cmdQ);
+        end = std::chrono::steady_clock::now();
+        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        if (debugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferred shared allocation 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(rangePtr), size, elapsedTime / 1e3);
+        }
+    }
+    if (!unprotectBeforeTransfer) {
+        this->allowCPUMemoryAccess(rangePtr, size);
+    }
+    pageFaultData.rangeDomains[rangeIndex] = AllocationDomain::cpu;
+
+    if (pageFaultData.domain == AllocationDomain::gpu) {
+        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(ptr);
+    }
+    if (pageFaultData.domain != AllocationDomain::cpu && !unprotectBeforeTransfer) {
+        this->setCpuAllocEvictable(true, ptr, pageFaultData.unifiedMemoryManager);
+        this->allowCPUMemoryEviction(ptr, pageFaultData);
+    }
+    pageFaultData.domain = AllocationDomain::cpu;
+}
+
+bool PageFaultManager::isRangeMigrationEnabled() {
+    return debugManager.flags.EnableRangeGranularUsmMigration.get() == 1;
+}
+
+size_t PageFaultManager::getMigrationRangeSize() {
+    if (debugManager.flags.UsmMigrationRangeSize.get() > 0) {
+        return alignUp(static_cast<size_t>(debugManager.flags.UsmMigrationRangeSize.get()), MemoryConstants::pageSize);
+    }
+    return MemoryConstants::pageSize2M;
+}
+
 void PageFaultManager::selectGpuDomainHandler() {
     if (debugManager.flags.SetCommandStreamReceiver.get() > CommandStreamReceiverType::CSR_HW || debugManager.flags.NEO_CAL_ENABLED.get()) {
         this->gpuDomainHandler = &PageFaultManager::unprotectAndTransferMemory;
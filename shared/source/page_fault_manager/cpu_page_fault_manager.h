@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 struct MemoryProperties;
@@ -43,6 +44,10 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        // Range-granular tracking (empty when allocation is migrated as a whole):
+        // only ranges touched by CPU are unprotected and transferred, domain is then cpu if any range is on CPU
+        size_t rangeSize;
+        std::vector<AllocationDomain> rangeDomains;
     };
 
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -52,6 +57,10 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ);
+
+    static bool isRangeMigrationEnabled();
+    static size_t getMigrationRangeSize();
 
   protected:
     virtual bool checkFaultHandlerFromPageFaultManager() = 0;
@@ -61,6 +70,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void setCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData);
@@ -70,6 +80,8 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     void selectGpuDomainHandler();
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    size_t migrateRangesToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void migrateRangeToCpuDomain(void *ptr, PageFaultData &pageFaultData, size_t rangeIndex);
 
     decltype(&transferAndUnprotectMemory) gpuDomainHandler = &transferAndUnprotectMemory;
 
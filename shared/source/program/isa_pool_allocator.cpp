@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/isa_pool_allocator.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/utilities/buffer_pool_allocator.inl"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include <cstring>
+
+namespace NEO {
+
+ISAPool::ISAPool(ISAPool &&pool) : BaseType(std::move(pool)) {
+    this->device = pool.device;
+    this->isBuiltin = pool.isBuiltin;
+    this->stackVec = std::move(pool.stackVec);
+    this->mtx = std::move(pool.mtx);
+}
+
+ISAPool::ISAPool(Device *device, bool isBuiltin, size_t storageSize)
+    : BaseType(device->getMemoryManager(), nullptr), device(device), isBuiltin(isBuiltin) {
+    auto allocationType = isBuiltin ? NEO::AllocationType::kernelIsaInternal : NEO::AllocationType::kernelIsa;
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties({device->getRootDeviceIndex(),
+                                                                                   storageSize,
+                                                                                   allocationType,
+                                                                                   device->getDeviceBitfield()});
+    this->mainStorage.reset(graphicsAllocation);
+    if (graphicsAllocation) {
+        this->chunkAllocator.reset(new NEO::HeapAllocator(startingOffset,
+                                                          graphicsAllocation->getUnderlyingBufferSize(),
+                                                          chunkAlignment));
+        this->stackVec.push_back(graphicsAllocation);
+    }
+    this->mtx = std::make_unique<std::mutex>();
+}
+
+ISAPool::~ISAPool() {
+    if (this->mainStorage) {
+        this->memoryManager->freeGraphicsMemory(this->mainStorage.release());
+    }
+}
+
+SharedIsaAllocation *ISAPool::allocateISA(size_t requestedSize) const {
+    auto offset = static_cast<size_t>(this->chunkAllocator->allocate(requestedSize));
+    if (offset == 0) {
+        return nullptr;
+    }
+    return new SharedIsaAllocation{this->mainStorage.get(), offset - startingOffset, requestedSize, this->mtx.get()};
+}
+
+const StackVec<GraphicsAllocation *, 1> &ISAPool::getAllocationsVector() {
+    return stackVec;
+}
+
+ISAPoolAllocator::ISAPoolAllocator(Device *device) : device(device) {
+}
+
+bool ISAPoolAllocator::isPoolingEnabled() {
+    return debugManager.flags.EnableIsaPooling.get() == 1;
+}
+
+SharedIsaAllocation *ISAPoolAllocator::requestGraphicsAllocationForIsa(bool isBuiltin, size_t size) {
+    if (false == this->isSizeWithinThreshold(size)) {
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    auto sharedIsaAllocation = this->tryAllocateISA(isBuiltin, size);
+    if (sharedIsaAllocation) {
+        return sharedIsaAllocation;
+    }
+
+    this->drain(this->getPools(isBuiltin));
+
+    sharedIsaAllocation = this->tryAllocateISA(isBuiltin, size);
+    if (sharedIsaAllocation) {
+        return sharedIsaAllocation;
+    }
+
+    this->addNewBufferPool(ISAPool{this->device, isBuiltin, aggregatedSmallBuffersPoolSize}, this->getPools(isBuiltin));
+    return this->tryAllocateISA(isBuiltin, size);
+}
+
+SharedIsaAllocation *ISAPoolAllocator::tryAllocateISA(bool isBuiltin, size_t size) {
+    for (auto &pool : this->getPools(isBuiltin)) {
+        if (auto sharedIsaAllocation = pool.allocateISA(size); sharedIsaAllocation != nullptr) {
+            sharedIsaAllocation->isBuiltin = isBuiltin;
+            return sharedIsaAllocation;
+        }
+    }
+    return nullptr;
+}
+
+void ISAPoolAllocator::freeSharedIsaAllocation(SharedIsaAllocation *sharedIsaAllocation) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    DEBUG_BREAK_IF(sharedIsaAllocation->refCount == 0u);
+    if (--sharedIsaAllocation->refCount > 0u) {
+        return;
+    }
+    if (sharedIsaAllocation->deduplicated) {
+        this->deduplicatedIsas.erase(ContentKey{sharedIsaAllocation->contentHash, sharedIsaAllocation->isBuiltin});
+    }
+    for (auto &pool : this->getPools(sharedIsaAllocation->isBuiltin)) {
+        pool.tryFreeFromPoolBuffer(sharedIsaAllocation->getGraphicsAllocation(), sharedIsaAllocation->getOffset(), sharedIsaAllocation->getSize());
+    }
+    delete sharedIsaAllocation;
+}
+
+SharedIsaAllocation *ISAPoolAllocator::acquireDeduplicatedIsa(const Hash128Value &contentHash, ArrayRef<const char> content, bool isBuiltin) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    auto it = this->deduplicatedIsas.find(ContentKey{contentHash, isBuiltin});
+    if (it == this->deduplicatedIsas.end()) {
+        return nullptr;
+    }
+    const auto &registeredContent = it->second->content;
+    if (registeredContent.size() != content.size() ||
+        (false == content.empty() && 0 != memcmp(registeredContent.data(), content.begin(), content.size()))) {
+        // hash collision, caller falls back to private allocation
+        return nullptr;
+    }
+    ++it->second->refCount;
+    return it->second;
+}
+
+void ISAPoolAllocator::registerDeduplicatedIsa(const Hash128Value &contentHash, ArrayRef<const char> content, SharedIsaAllocation *sharedIsaAllocation) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (sharedIsaAllocation->deduplicated) {
+        return;
+    }
+    // ISA is registered only after it was uploaded, so a concurrently created module with the same content
+    // may have registered its own copy first - it is kept and this allocation stays private to its module
+    auto inserted = this->deduplicatedIsas.insert({ContentKey{contentHash, sharedIsaAllocation->isBuiltin}, sharedIsaAllocation}).second;
+    if (inserted) {
+        sharedIsaAllocation->deduplicated = true;
+        sharedIsaAllocation->contentHash = contentHash;
+        sharedIsaAllocation->content.assign(content.begin(), content.end());
+    }
+}
+
+size_t ISAPoolAllocator::getDeduplicatedIsaCount() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->deduplicatedIsas.size();
+}
+
+void ISAPoolAllocator::releasePools() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->deduplicatedIsas.clear();
+    this->bufferPools.clear();
+    this->builtinPools.clear();
+}
+
+} // namespace NEO
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/hash128.h"
+#include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/buffer_pool_allocator.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class Device;
+class GraphicsAllocation;
+class ISAPool;
+class ISAPoolAllocator;
+
+// Kernel ISA sub-allocated from a pool shared by many modules of a device.
+// The same object may be handed out to several modules with identical ISA (see ISAPoolAllocator),
+// it is released once the last of them frees it.
+class SharedIsaAllocation : NonCopyableOrMovableClass {
+  public:
+    SharedIsaAllocation(GraphicsAllocation *graphicsAllocation, size_t offset, size_t size, std::mutex *mtx)
+        : graphicsAllocation(graphicsAllocation), offset(offset), size(size), mtx(mtx){};
+
+    GraphicsAllocation *getGraphicsAllocation() const { return graphicsAllocation; }
+    size_t getOffset() const { return offset; }
+    size_t getSize() const { return size; }
+    std::unique_lock<std::mutex> obtainSharedAllocationLock() { return std::unique_lock<std::mutex>(*mtx); }
+
+  protected:
+    friend class ISAPoolAllocator;
+
+    GraphicsAllocation *graphicsAllocation;
+    const size_t offset;
+    const size_t size;
+    std::mutex *mtx;
+    uint32_t refCount = 1u;
+    bool isBuiltin = false;
+    bool deduplicated = false;
+    Hash128Value contentHash{};
+    std::vector<char> content; // host copy of deduplicated ISA, hash match alone is not trusted
+};
+
+template <>
+struct SmallBuffersParams<ISAPool> {
+  protected:
+    static constexpr auto aggregatedSmallBuffersPoolSize = 2 * MemoryConstants::megaByte;
+    static constexpr auto smallBufferThreshold = MemoryConstants::pageSize64k;
+    static constexpr auto chunkAlignment = MemoryConstants::cacheLineSize;
+    static constexpr auto startingOffset = chunkAlignment;
+};
+
+class ISAPool : public AbstractBuffersPool<ISAPool, GraphicsAllocation> {
+    using BaseType = AbstractBuffersPool<ISAPool, GraphicsAllocation>;
+
+  public:
+    ISAPool(ISAPool &&pool);
+    ISAPool &operator=(ISAPool &&other) = delete;
+    ISAPool(Device *device, bool isBuiltin, size_t storageSize);
+    ~ISAPool();
+
+    SharedIsaAllocation *allocateISA(size_t requestedSize) const;
+    const StackVec<GraphicsAllocation *, 1> &getAllocationsVector();
+    bool isBuiltinPool() const { return isBuiltin; }
+
+  protected:
+    Device *device = nullptr;
+    bool isBuiltin = false;
+    StackVec<GraphicsAllocation *, 1> stackVec;
+    std::unique_ptr<std::mutex> mtx;
+};
+
+// Device-wide allocator of kernel ISA for small modules.
+// ISA is sub-allocated from large pools instead of taking a whole page per module,
+// and modules with identical, relocation-free ISA share a single copy (content hash lookup verified by comparing content).
+class ISAPoolAllocator : public AbstractBuffersAllocator<ISAPool, GraphicsAllocation> {
+  public:
+    ISAPoolAllocator(Device *device);
+
+    static bool isPoolingEnabled();
+
+    SharedIsaAllocation *requestGraphicsAllocationForIsa(bool isBuiltin, size_t size);
+    void freeSharedIsaAllocation(SharedIsaAllocation *sharedIsaAllocation);
+
+    SharedIsaAllocation *acquireDeduplicatedIsa(const Hash128Value &contentHash, ArrayRef<const char> content, bool isBuiltin);
+    void registerDeduplicatedIsa(const Hash128Value &contentHash, ArrayRef<const char> content, SharedIsaAllocation *sharedIsaAllocation);
+    size_t getDeduplicatedIsaCount();
+
+    void releasePools();
+
+  protected:
+    struct ContentKey {
+        Hash128Value contentHash;
+        bool isBuiltin;
+
+        bool operator==(const ContentKey &other) const {
+            return contentHash == other.contentHash && isBuiltin == other.isBuiltin;
+        }
+    };
+    struct ContentKeyHasher {
+        size_t operator()(const ContentKey &key) const {
+            return static_cast<size_t>(key.contentHash.low ^ key.contentHash.high ^ static_cast<uint64_t>(key.isBuiltin));
+        }
+    };
+
+    SharedIsaAllocation *tryAllocateISA(bool isBuiltin, size_t size);
+    std::vector<ISAPool> &getPools(bool isBuiltin) { return isBuiltin ? this->builtinPools : this->bufferPools; }
+
+    Device *device;
+    std::vector<ISAPool> builtinPools;
+    std::unordered_map<ContentKey, SharedIsaAllocation *, ContentKeyHasher> deduplicatedIsas;
+};
+
+} // namespace NEO
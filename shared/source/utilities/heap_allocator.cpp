@@ -7,6 +7,7 @@
 
 #include "shared/source/utilities/heap_allocator.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/utilities/logger.h"
 
@@ -18,6 +19,26 @@ bool operator<(const HeapChunk &hc1, const HeapChunk &hc2) {
     return hc1.ptr < hc2.ptr;
 }
 
+HeapAllocator::HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold, HeapAllocatorMode mode)
+    : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
+    pLeftBound = address;
+    pRightBound = address + size;
+
+    if (debugManager.flags.ForceHeapAllocatorMode.get() != -1) {
+        mode = static_cast<HeapAllocatorMode>(debugManager.flags.ForceHeapAllocatorMode.get());
+    }
+
+    if (mode == HeapAllocatorMode::sizeClassBinned) {
+        binnedFreeLists = std::make_unique<SizeClassFreeLists>(allocationAlignment);
+        if (size > 0u) {
+            binnedFreeLists->free(address, static_cast<size_t>(size));
+        }
+    } else {
+        freedChunksBig.reserve(10);
+        freedChunksSmall.reserve(50);
+    }
+}
+
 uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment) {
     if (alignment < this->allocationAlignment) {
         alignment = this->allocationAlignment;
@@ -32,6 +53,14 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
         return 0llu;
     }
 
+    if (binnedFreeLists) {
+        uint64_t ptrReturn = binnedFreeLists->allocate(sizeToAllocate, alignment);
+        if (ptrReturn != 0llu) {
+            availableSize -= sizeToAllocate;
+        }
+        return ptrReturn;
+    }
+
     std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
     uint32_t defragmentCount = 0;
 
@@ -89,7 +118,9 @@ void HeapAllocator::free(uint64_t ptr, size_t size) {
     std::lock_guard<std::mutex> lock(mtx);
     DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
 
-    if (ptr == pRightBound) {
+    if (binnedFreeLists) {
+        binnedFreeLists->free(ptr, size);
+    } else if (ptr == pRightBound) {
         pRightBound = ptr + size;
         mergeLastFreedSmall();
     } else if (ptr == pLeftBound - size) {
@@ -159,6 +190,9 @@ uint64_t HeapAllocator::getFromFreedChunks(size_t size, std::vector<HeapChunk> &
 }
 
 void HeapAllocator::defragment() {
+    if (binnedFreeLists) {
+        return;
+    }
 
     if (freedChunksSmall.size() > 1) {
         std::sort(freedChunksSmall.rbegin(), freedChunksSmall.rend());
@@ -8,8 +8,10 @@
 #pragma once
 
 #include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/size_class_free_lists.h"
 
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -23,6 +25,11 @@ struct HeapChunk {
 
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
 
+enum class HeapAllocatorMode : uint32_t {
+    twoSided = 0,
+    sizeClassBinned = 1
+};
+
 class HeapAllocator {
   public:
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, MemoryConstants::pageSize) {
@@ -31,13 +38,11 @@ class HeapAllocator {
     HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment) : HeapAllocator(address, size, allocationAlignment, 4 * MemoryConstants::megaByte) {
     }
 
-    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
-        pLeftBound = address;
-        pRightBound = address + size;
-        freedChunksBig.reserve(10);
-        freedChunksSmall.reserve(50);
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : HeapAllocator(address, size, allocationAlignment, threshold, HeapAllocatorMode::twoSided) {
     }
 
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold, HeapAllocatorMode mode);
+
     MOCKABLE_VIRTUAL ~HeapAllocator() = default;
 
     uint64_t allocate(size_t &sizeToAllocate) {
@@ -58,6 +63,10 @@ class HeapAllocator {
 
     double getUsage() const;
 
+    HeapAllocatorMode getMode() const {
+        return binnedFreeLists ? HeapAllocatorMode::sizeClassBinned : HeapAllocatorMode::twoSided;
+    }
+
   protected:
     const uint64_t size;
     uint64_t availableSize;
@@ -68,6 +77,7 @@ class HeapAllocator {
 
     std::vector<HeapChunk> freedChunksSmall;
     std::vector<HeapChunk> freedChunksBig;
+    std::unique_ptr<SizeClassFreeLists> binnedFreeLists;
     std::mutex mtx;
 
     uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment);
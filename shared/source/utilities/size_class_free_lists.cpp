@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/size_class_free_lists.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+
+namespace NEO {
+
+namespace {
+uint32_t getLowestSetBit(uint64_t value) {
+    auto lowPart = static_cast<uint32_t>(value);
+    if (lowPart != 0u) {
+        return Math::getMinLsbSet(lowPart);
+    }
+    return 32u + Math::getMinLsbSet(static_cast<uint32_t>(value >> 32));
+}
+} // namespace
+
+void SizeClassFreeLists::mapSizeToBin(size_t size, uint32_t &firstLevel, uint32_t &secondLevel) const {
+    uint64_t units = size / granularity;
+    if (units < secondLevelCount) {
+        firstLevel = 0u;
+        secondLevel = static_cast<uint32_t>(units);
+        return;
+    }
+    auto mostSignificantBit = Math::log2(units);
+    firstLevel = mostSignificantBit - secondLevelBits + 1u;
+    secondLevel = static_cast<uint32_t>(units >> (mostSignificantBit - secondLevelBits)) - secondLevelCount;
+}
+
+bool SizeClassFreeLists::findSuitableBin(size_t size, uint32_t &firstLevel, uint32_t &secondLevel) const {
+    // round the request up to the next size class, so that every block in the found bin fits
+    uint64_t units = alignUp(static_cast<uint64_t>(size), granularity) / granularity;
+    if (units >= secondLevelCount) {
+        units += (1ull << (Math::log2(units) - secondLevelBits)) - 1u;
+    }
+    mapSizeToBin(static_cast<size_t>(units * granularity), firstLevel, secondLevel);
+    if (firstLevel >= firstLevelCount) {
+        return false;
+    }
+
+    auto secondLevelMask = secondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+    if (secondLevelMask == 0u) {
+        auto firstLevelMask = (firstLevel + 1u < 64u) ? (firstLevelBitmap & (~0ull << (firstLevel + 1u))) : 0u;
+        if (firstLevelMask == 0u) {
+            return false;
+        }
+        firstLevel = getLowestSetBit(firstLevelMask);
+        secondLevelMask = secondLevelBitmaps[firstLevel];
+    }
+    secondLevel = Math::getMinLsbSet(secondLevelMask);
+    return true;
+}
+
+void SizeClassFreeLists::insertBlock(uint64_t ptr, size_t size) {
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+    mapSizeToBin(size, firstLevel, secondLevel);
+
+    auto &bin = bins[firstLevel][secondLevel];
+    bin.push_front(ptr);
+    blocksByAddress.emplace(ptr, FreeBlock{size, firstLevel, secondLevel, bin.begin()});
+
+    secondLevelBitmaps[firstLevel] |= (1u << secondLevel);
+    firstLevelBitmap |= (1ull << firstLevel);
+}
+
+void SizeClassFreeLists::removeBlock(BlocksByAddress::iterator block) {
+    auto firstLevel = block->second.firstLevel;
+    auto secondLevel = block->second.secondLevel;
+    auto &bin = bins[firstLevel][secondLevel];
+    bin.erase(block->second.binIterator);
+    blocksByAddress.erase(block);
+
+    if (bin.empty()) {
+        secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+        if (secondLevelBitmaps[firstLevel] == 0u) {
+            firstLevelBitmap &= ~(1ull << firstLevel);
+        }
+    }
+}
+
+uint64_t SizeClassFreeLists::allocateFromBin(uint32_t firstLevel, uint32_t secondLevel, size_t size, size_t alignment) {
+    auto block = blocksByAddress.find(bins[firstLevel][secondLevel].front());
+    DEBUG_BREAK_IF(block == blocksByAddress.end());
+    return allocateFromBlock(block, size, alignment);
+}
+
+uint64_t SizeClassFreeLists::allocateFromBlock(BlocksByAddress::iterator block, size_t size, size_t alignment) {
+    const uint64_t blockPtr = block->first;
+    const uint64_t blockEnd = blockPtr + block->second.size;
+    const uint64_t alignedPtr = alignUp(blockPtr, alignment);
+    if (alignedPtr + size > blockEnd) {
+        return 0llu;
+    }
+
+    removeBlock(block);
+    if (alignedPtr > blockPtr) {
+        insertBlock(blockPtr, static_cast<size_t>(alignedPtr - blockPtr));
+    }
+    if (alignedPtr + size < blockEnd) {
+        insertBlock(alignedPtr + size, static_cast<size_t>(blockEnd - alignedPtr - size));
+    }
+    return alignedPtr;
+}
+
+uint64_t SizeClassFreeLists::allocate(size_t size, size_t alignment) {
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+
+    // blocks normally start at granularity boundary, so only the extra alignment has to be reserved
+    size_t searchSize = size + (alignment > granularity ? alignment - granularity : 0u);
+    if (findSuitableBin(searchSize, firstLevel, secondLevel)) {
+        auto ptr = allocateFromBin(firstLevel, secondLevel, size, alignment);
+        if (ptr != 0llu) {
+            return ptr;
+        }
+    }
+
+    // block start was not aligned to granularity, reserve space for any misalignment
+    searchSize = size + alignment - 1u;
+    if (findSuitableBin(searchSize, firstLevel, secondLevel)) {
+        auto ptr = allocateFromBin(firstLevel, secondLevel, size, alignment);
+        if (ptr != 0llu) {
+            return ptr;
+        }
+    }
+
+    return allocateFromPartiallyFittingBins(size, alignment);
+}
+
+uint64_t SizeClassFreeLists::allocateFromPartiallyFittingBins(size_t size, size_t alignment) {
+    // size classes skipped by rounded search may still hold a block that fits, e.g. block of exactly requested size
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+    uint32_t lastFirstLevel = 0u;
+    uint32_t lastSecondLevel = 0u;
+    mapSizeToBin(alignUp(size, granularity), firstLevel, secondLevel);
+    mapSizeToBin(size + alignment - 1u, lastFirstLevel, lastSecondLevel);
+    lastFirstLevel = std::min(lastFirstLevel, firstLevelCount - 1u);
+
+    for (; firstLevel <= lastFirstLevel; firstLevel++, secondLevel = 0u) {
+        const uint32_t lastSecondLevelInRow = (firstLevel == lastFirstLevel) ? lastSecondLevel : secondLevelCount - 1u;
+        for (; secondLevel <= lastSecondLevelInRow; secondLevel++) {
+            if ((secondLevelBitmaps[firstLevel] & (1u << secondLevel)) == 0u) {
+                continue;
+            }
+            for (auto ptr : bins[firstLevel][secondLevel]) {
+                auto block = blocksByAddress.find(ptr);
+                if (alignUp(ptr, alignment) + size <= ptr + block->second.size) {
+                    return allocateFromBlock(block, size, alignment);
+                }
+            }
+        }
+    }
+    return 0llu;
+}
+
+void SizeClassFreeLists::free(uint64_t ptr, size_t size) {
+    auto next = blocksByAddress.lower_bound(ptr);
+    if (next != blocksByAddress.end() && next->first == ptr + size) {
+        size += next->second.size;
+        removeBlock(next);
+    }
+
+    next = blocksByAddress.lower_bound(ptr);
+    if (next != blocksByAddress.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second.size == ptr) {
+            ptr = previous->first;
+            size += previous->second.size;
+            removeBlock(previous);
+        }
+    }
+
+    insertBlock(ptr, size);
+}
+
+size_t SizeClassFreeLists::getLargestFreeBlockSize() const {
+    if (firstLevelBitmap == 0u) {
+        return 0u;
+    }
+    auto firstLevel = Math::log2(firstLevelBitmap);
+    auto secondLevel = Math::log2(secondLevelBitmaps[firstLevel]);
+
+    size_t largestSize = 0u;
+    for (auto ptr : bins[firstLevel][secondLevel]) {
+        largestSize = std::max(largestSize, blocksByAddress.find(ptr)->second.size);
+    }
+    return largestSize;
+}
+
+} // namespace NEO
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+
+namespace NEO {
+
+// Two-level segregated fit (TLSF-style) free lists over an address range.
+// Free blocks are binned by size class (power of two split into sub-steps), so finding
+// a fitting block is a bitmap scan instead of a walk over all freed chunks.
+// Freed blocks are coalesced with their neighbours immediately.
+class SizeClassFreeLists {
+  public:
+    static constexpr uint32_t secondLevelBits = 4u;
+    static constexpr uint32_t secondLevelCount = 1u << secondLevelBits;
+    static constexpr uint32_t firstLevelCount = 64u - secondLevelBits + 1u;
+
+    explicit SizeClassFreeLists(size_t granularity) : granularity(granularity) {}
+
+    void free(uint64_t ptr, size_t size);
+    uint64_t allocate(size_t size, size_t alignment);
+
+    size_t getNumFreeBlocks() const { return blocksByAddress.size(); }
+    size_t getLargestFreeBlockSize() const;
+
+  protected:
+    struct FreeBlock {
+        size_t size;
+        uint32_t firstLevel;
+        uint32_t secondLevel;
+        std::list<uint64_t>::iterator binIterator;
+    };
+    using BlocksByAddress = std::map<uint64_t, FreeBlock>;
+
+    void mapSizeToBin(size_t size, uint32_t &firstLevel, uint32_t &secondLevel) const;
+    bool findSuitableBin(size_t size, uint32_t &firstLevel, uint32_t &secondLevel) const;
+    void insertBlock(uint64_t ptr, size_t size);
+    void removeBlock(BlocksByAddress::iterator block);
+    uint64_t allocateFromBin(uint32_t firstLevel, uint32_t secondLevel, size_t size, size_t alignment);
+    uint64_t allocateFromBlock(BlocksByAddress::iterator block, size_t size, size_t alignment);
+    uint64_t allocateFromPartiallyFittingBins(size_t size, size_t alignment);
+
+    const size_t granularity;
+    uint64_t firstLevelBitmap = 0u;
+    std::array<uint32_t, firstLevelCount> secondLevelBitmaps{};
+    std::array<std::array<std::list<uint64_t>, secondLevelCount>, firstLevelCount> bins;
+    BlocksByAddress blocksByAddress;
+};
+} // namespace NEO
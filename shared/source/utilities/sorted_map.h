@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+
+namespace NEO {
+
+// Range index keyed by allocation base pointer.
+// Insert, remove and lookup (including lookup by pointer inside an allocation) are O(log n),
+// which keeps allocation trackers usable with hundreds of thousands of live entries.
+// Const lookups do not modify the container, so concurrent readers only need a shared lock.
+template <typename ValueType>
+class BaseSortedPointerWithValueMap {
+  public:
+    using Container = std::map<const void *, std::unique_ptr<ValueType>>;
+
+    BaseSortedPointerWithValueMap() = default;
+
+    void insert(const void *ptr, const ValueType &value) {
+        allocations.insert_or_assign(ptr, std::make_unique<ValueType>(value));
+    }
+
+    void remove(const void *ptr) {
+        allocations.erase(ptr);
+    }
+
+    typename Container::const_iterator getImpl(const void *ptr, bool allowOffset) const {
+        if (allocations.empty() || nullptr == ptr) {
+            return allocations.end();
+        }
+
+        auto it = allocations.upper_bound(ptr);
+        if (it == allocations.begin()) {
+            return allocations.end();
+        }
+        --it;
+
+        if (it->first == ptr) {
+            return it;
+        }
+        if (allowOffset && reinterpret_cast<uintptr_t>(ptr) < reinterpret_cast<uintptr_t>(it->first) + it->second->size) {
+            return it;
+        }
+        return allocations.end();
+    }
+
+    std::unique_ptr<ValueType> extract(const void *ptr) {
+        std::unique_ptr<ValueType> retVal{};
+        if (nullptr == ptr) {
+            return retVal;
+        }
+        auto it = allocations.find(ptr);
+        if (it != allocations.end()) {
+            retVal.swap(it->second);
+            allocations.erase(it);
+        }
+        return retVal;
+    }
+
+    ValueType *get(const void *ptr) const {
+        auto it = getImpl(ptr, true);
+        if (it != allocations.end()) {
+            return it->second.get();
+        }
+        return nullptr;
+    }
+
+    size_t getNumAllocs() const { return allocations.size(); }
+
+    Container allocations;
+};
+} // namespace NEO
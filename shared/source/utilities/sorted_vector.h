@@ -34,21 +34,19 @@ class BaseSortedPointerWithValueVector {
     }
 
     void insert(const void *ptr, const ValueType &value) {
-        allocations.push_back(std::make_pair(ptr, std::make_unique<ValueType>(value)));
-        for (size_t i = allocations.size() - 1; i > 0; --i) {
-            if (allocations[i].first < allocations[i - 1].first) {
-                std::iter_swap(allocations.begin() + i, allocations.begin() + i - 1);
-            } else {
-                break;
-            }
-        }
+        auto insertIt = std::upper_bound(allocations.begin(), allocations.end(), ptr, [](const void *ptr, const PointerPair &other) {
+            return ptr < other.first;
+        });
+        allocations.insert(insertIt, std::make_pair(ptr, std::make_unique<ValueType>(value)));
     }
 
     void remove(const void *ptr) {
-        auto removeIt = std::remove_if(allocations.begin(), allocations.end(), [&ptr](const PointerPair &other) {
-            return ptr == other.first;
+        auto removeIt = std::lower_bound(allocations.begin(), allocations.end(), ptr, [](const PointerPair &other, const void *ptr) {
+            return other.first < ptr;
         });
-        allocations.erase(removeIt);
+        if (removeIt != allocations.end() && removeIt->first == ptr) {
+            allocations.erase(removeIt);
+        }
     }
 
     typename Container::iterator getImpl(const void *ptr, bool allowOffset) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -94,6 +94,10 @@ class TagNodeBase : public NonCopyableOrMovableClass {
     bool doNotReleaseNodes = false;
     bool profilingCapable = true;
 
+    // Lock-free free list linkage, 1-based index of node within its allocator (0 terminates the list)
+    uint32_t freeListIndex = 0;
+    std::atomic<uint32_t> freeListNext{0};
+
     template <typename TagType>
     friend class TagAllocator;
 };
@@ -195,11 +199,29 @@ class TagAllocator : public TagAllocatorBase {
 
     void populateFreeTags();
 
+    NodeType *obtainFreeTag();
+    NodeType *obtainFreeTagLockFree();
+
+    static bool isInFreeTagsStack(const NodeType &node);
+    NodeType *popFreeTag();
+    void pushFreeTags(NodeType &first, NodeType &last);
+    NodeType *getNodeByFreeListIndex(uint32_t index) const;
+
+    static constexpr uint32_t maxNodeChunks = 1024u;
+
     IDList<NodeType> freeTags;
     IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
 
     std::vector<std::unique_ptr<NodeType[]>> tagPoolMemory;
+
+    // Treiber stack of free tags used instead of freeTags/usedTags when EnableLockFreeTagAllocator is set.
+    // Only first maxNodeChunks pools are addressable by the stack, nodes of later pools use freeTags/usedTags.
+    // Head packs 1-based node index (low 32 bits) with modification counter (high 32 bits) to avoid ABA.
+    std::atomic<uint64_t> freeTagsStackHead{0};
+    std::unique_ptr<NodeType *[]> nodeChunks;
+    uint32_t nodeChunksCount = 0u;
+    bool lockFreeFreeList = false;
 };
 } // namespace NEO
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,11 +17,29 @@ TagAllocator<TagType>::TagAllocator(const RootDeviceIndicesContainer &rootDevice
     : TagAllocatorBase(rootDeviceIndices, memMngr, tagCount, tagAlignment, tagSize, doNotReleaseNodes, deviceBitfield) {
     std::unique_lock<std::mutex> lock(allocatorMutex);
 
+    if (debugManager.flags.EnableLockFreeTagAllocator.get() == 1) {
+        lockFreeFreeList = true;
+        nodeChunks = std::make_unique<NodeType *[]>(maxNodeChunks);
+    }
+
     populateFreeTags();
 }
 
 template <typename TagType>
 TagNodeBase *TagAllocator<TagType>::getTag() {
+    auto node = lockFreeFreeList ? obtainFreeTagLockFree() : obtainFreeTag();
+    node->incRefCount();
+    node->initialize();
+
+    if (debugManager.flags.PrintTimestampPacketUsage.get() == 1) {
+        printf("\nPID: %u, TSP taken from pool and initialized: 0x%" PRIX64, SysCalls::getProcessId(), node->getGpuAddress());
+    }
+
+    return node;
+}
+
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::obtainFreeTag() {
     if (freeTags.peekIsEmpty()) {
         releaseDeferredTags();
     }
@@ -32,32 +50,100 @@ TagNodeBase *TagAllocator<TagType>::getTag() {
         node = freeTags.removeFrontOne().release();
     }
     usedTags.pushFrontOne(*node);
-    node->incRefCount();
-    node->initialize();
+    return node;
+}
 
-    if (debugManager.flags.PrintTimestampPacketUsage.get() == 1) {
-        printf("\nPID: %u, TSP taken from pool and initialized: 0x%" PRIX64, SysCalls::getProcessId(), node->getGpuAddress());
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::obtainFreeTagLockFree() {
+    auto node = popFreeTag();
+    if (!node) {
+        releaseDeferredTags();
+        node = popFreeTag();
+    }
+    if (!node) {
+        node = freeTags.removeFrontOne().release();
+    }
+    if (!node) {
+        std::unique_lock<std::mutex> lock(allocatorMutex);
+        node = popFreeTag();
+        if (!node) {
+            populateFreeTags();
+            node = popFreeTag();
+        }
+        if (!node) {
+            node = freeTags.removeFrontOne().release();
+        }
+    }
+    if (!isInFreeTagsStack(*node)) {
+        usedTags.pushFrontOne(*node);
     }
-
     return node;
 }
 
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::getNodeByFreeListIndex(uint32_t index) const {
+    auto nodePosition = static_cast<size_t>(index - 1);
+    return &nodeChunks[nodePosition / tagCount][nodePosition % tagCount];
+}
+
+template <typename TagType>
+bool TagAllocator<TagType>::isInFreeTagsStack(const NodeType &node) {
+    return node.freeListIndex != 0u;
+}
+
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::popFreeTag() {
+    auto head = freeTagsStackHead.load(std::memory_order_acquire);
+    while (true) {
+        auto headIndex = static_cast<uint32_t>(head);
+        if (headIndex == 0u) {
+            return nullptr;
+        }
+        auto node = getNodeByFreeListIndex(headIndex);
+        // stale next is harmless - counter in head changes on every push and pop, so CAS fails
+        uint64_t newHead = ((head >> 32) + 1) << 32 | node->freeListNext.load(std::memory_order_relaxed);
+        if (freeTagsStackHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire)) {
+            return node;
+        }
+    }
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::pushFreeTags(NodeType &first, NodeType &last) {
+    auto head = freeTagsStackHead.load(std::memory_order_relaxed);
+    uint64_t newHead = 0u;
+    do {
+        last.freeListNext.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        newHead = ((head >> 32) + 1) << 32 | first.freeListIndex;
+    } while (!freeTagsStackHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToFreePool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
-    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(usedNode == nullptr);
+    if (!isInFreeTagsStack(*nodeT)) {
+        [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
+        DEBUG_BREAK_IF(usedNode == nullptr);
+    }
 
     if (debugManager.flags.PrintTimestampPacketUsage.get() == 1) {
         printf("\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), nodeT->getGpuAddress());
     }
 
-    freeTags.pushFrontOne(*nodeT);
+    if (isInFreeTagsStack(*nodeT)) {
+        pushFreeTags(*nodeT, *nodeT);
+    } else {
+        freeTags.pushFrontOne(*nodeT);
+    }
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToDeferredPool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
+    if (isInFreeTagsStack(*nodeT)) {
+        deferredTags.pushFrontOne(*nodeT);
+        return;
+    }
     auto usedNode = usedTags.removeOne(*nodeT).release();
     DEBUG_BREAK_IF(!usedNode);
     deferredTags.pushFrontOne(*usedNode);
@@ -75,7 +161,13 @@ void TagAllocator<TagType>::releaseDeferredTags() {
             if (debugManager.flags.PrintTimestampPacketUsage.get() == 1) {
                 printf("\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), currentNode->getGpuAddress());
             }
-            pendingFreeTags.pushFrontOne(*currentNode);
+            if (isInFreeTagsStack(*currentNode)) {
+                currentNode->next = nullptr;
+                currentNode->prev = nullptr;
+                pushFreeTags(*currentNode, *currentNode);
+            } else {
+                pendingFreeTags.pushFrontOne(*currentNode);
+            }
         } else {
             pendingDeferredTags.pushFrontOne(*currentNode);
         }
@@ -118,6 +210,14 @@ void TagAllocator<TagType>::populateFreeTags() {
 
     auto nodesMemory = std::make_unique<NodeType[]>(tagCount);
 
+    // once chunk table is full, further pools fall back to spin-locked free and used lists
+    const bool useFreeTagsStack = lockFreeFreeList && nodeChunksCount < maxNodeChunks;
+    uint32_t firstFreeListIndex = 0u;
+    if (useFreeTagsStack) {
+        firstFreeListIndex = static_cast<uint32_t>(nodeChunksCount * tagCount) + 1;
+        nodeChunks[nodeChunksCount++] = nodesMemory.get();
+    }
+
     for (size_t i = 0; i < tagCount; ++i) {
         auto tagOffset = i * tagSize;
 
@@ -127,7 +227,16 @@ void TagAllocator<TagType>::populateFreeTags() {
         nodesMemory[i].gpuAddress = baseGpuAddress + tagOffset;
         nodesMemory[i].setDoNotReleaseNodes(doNotReleaseNodes);
 
-        freeTags.pushTailOne(nodesMemory[i]);
+        if (useFreeTagsStack) {
+            nodesMemory[i].freeListIndex = firstFreeListIndex + static_cast<uint32_t>(i);
+            nodesMemory[i].freeListNext.store(i + 1 < tagCount ? nodesMemory[i].freeListIndex + 1 : 0u, std::memory_order_relaxed);
+        } else {
+            freeTags.pushTailOne(nodesMemory[i]);
+        }
+    }
+
+    if (useFreeTagsStack) {
+        pushFreeTags(nodesMemory[0], nodesMemory[tagCount - 1]);
     }
 
     tagPoolMemory.push_back(std::move(nodesMemory));
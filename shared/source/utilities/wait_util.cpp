@@ -30,6 +30,10 @@ bool waitpkgSupport = false;
 #endif
 bool waitpkgUse = false;
 
+WaitPolicy waitPolicy = WaitPolicy::fixed;
+int64_t adaptiveSpinTime = defaultAdaptiveSpinTime;
+int64_t adaptiveSleepTime = defaultAdaptiveSleepTime;
+
 void init() {
     bool enableWaitPkg = defaultEnableWaitPkg;
     int32_t overrideEnableWaitPkg = debugManager.flags.EnableWaitpkg.get();
@@ -56,6 +60,19 @@ void init() {
     if (overrideWaitCount != -1) {
         waitCount = static_cast<uint32_t>(overrideWaitCount);
     }
+
+    int32_t overrideWaitPolicy = debugManager.flags.WaitPolicy.get();
+    if (overrideWaitPolicy != -1) {
+        waitPolicy = static_cast<WaitPolicy>(overrideWaitPolicy);
+    }
+    int32_t overrideAdaptiveSpinTime = debugManager.flags.AdaptiveWaitSpinTime.get();
+    if (overrideAdaptiveSpinTime != -1) {
+        adaptiveSpinTime = static_cast<int64_t>(overrideAdaptiveSpinTime);
+    }
+    int32_t overrideAdaptiveSleepTime = debugManager.flags.AdaptiveWaitSleepTime.get();
+    if (overrideAdaptiveSleepTime != -1) {
+        adaptiveSleepTime = static_cast<int64_t>(overrideAdaptiveSleepTime);
+    }
 }
 
 } // namespace WaitUtils
@@ -9,6 +9,8 @@
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <thread>
@@ -17,13 +19,84 @@ namespace NEO {
 
 namespace WaitUtils {
 
+enum class WaitPolicy : int32_t {
+    fixed = 0,
+    adaptive = 1
+};
+
 constexpr uint32_t defaultWaitCount = 1u;
+constexpr int64_t defaultAdaptiveSpinTime = 10;
+constexpr int64_t defaultAdaptiveSleepTime = 100;
 
 extern uint64_t waitpkgCounterValue;
 extern uint32_t waitpkgControlValue;
 extern uint32_t waitCount;
 extern bool waitpkgSupport;
 extern bool waitpkgUse;
+extern WaitPolicy waitPolicy;
+extern int64_t adaptiveSpinTime;
+extern int64_t adaptiveSleepTime;
+
+// Completion latency learned for a single wait target (e.g. tag of a CSR), times in microseconds.
+// Wait starts with busy polling, escalates to umwait while completion is expected soon
+// and falls back to sleeping when it is far away or already overdue.
+class AdaptiveWaitState {
+  public:
+    enum class Phase : uint32_t {
+        spin = 0,
+        monitor,
+        sleep,
+        count
+    };
+
+    struct Statistics {
+        uint64_t waits = 0;
+        uint64_t completions[static_cast<uint32_t>(Phase::count)] = {};
+        int64_t expectedLatency = 0;
+    };
+
+    Phase getPhase(int64_t elapsedTime) const {
+        if (elapsedTime < adaptiveSpinTime) {
+            return Phase::spin;
+        }
+        auto expected = expectedLatency.load(std::memory_order_relaxed);
+        if (expected > elapsedTime + adaptiveSleepTime) {
+            return Phase::sleep;
+        }
+        if (elapsedTime < 2 * expected + adaptiveSleepTime) {
+            return Phase::monitor;
+        }
+        return Phase::sleep;
+    }
+
+    void recordWait(int64_t latency, Phase completedIn) {
+        auto expected = expectedLatency.load(std::memory_order_relaxed);
+        if (waits.fetch_add(1, std::memory_order_relaxed) == 0) {
+            expected = latency;
+        } else {
+            expected += (latency - expected) / ewmaWeight;
+        }
+        expectedLatency.store(expected, std::memory_order_relaxed);
+        completions[static_cast<uint32_t>(completedIn)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Statistics getStatistics() const {
+        Statistics statistics;
+        statistics.waits = waits.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < static_cast<uint32_t>(Phase::count); i++) {
+            statistics.completions[i] = completions[i].load(std::memory_order_relaxed);
+        }
+        statistics.expectedLatency = expectedLatency.load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+  protected:
+    static constexpr int64_t ewmaWeight = 8;
+
+    std::atomic<int64_t> expectedLatency{0};
+    std::atomic<uint64_t> waits{0};
+    std::atomic<uint64_t> completions[static_cast<uint32_t>(Phase::count)] = {};
+};
 
 inline bool monitorWait(volatile void const *monitorAddress, uint64_t counterModifier) {
     uint64_t currentCounter = CpuIntrinsics::rdtsc();
@@ -34,8 +107,8 @@ inline bool monitorWait(volatile void const *monitorAddress, uint64_t counterMod
     return result;
 }
 
-template <typename T>
-inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, std::function<bool(T, T)> predicate) {
+template <typename T, typename Predicate>
+inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, Predicate predicate) {
     for (uint32_t i = 0; i < waitCount; i++) {
         CpuIntrinsics::pause();
     }
@@ -59,6 +132,27 @@ inline bool waitFunction(volatile TagAddressType *pollAddress, TaskCountType exp
     return waitFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>());
 }
 
+template <typename T, typename Predicate>
+inline bool adaptiveWaitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, Predicate predicate, AdaptiveWaitState::Phase phase) {
+    if (phase == AdaptiveWaitState::Phase::sleep) {
+        std::this_thread::sleep_for(std::chrono::microseconds(adaptiveSleepTime));
+    } else if (phase == AdaptiveWaitState::Phase::monitor && waitpkgUse && pollAddress != nullptr) {
+        monitorWait(pollAddress, 0);
+    } else {
+        for (uint32_t i = 0; i < waitCount; i++) {
+            CpuIntrinsics::pause();
+        }
+        if (phase == AdaptiveWaitState::Phase::monitor) {
+            std::this_thread::yield();
+        }
+    }
+    return pollAddress != nullptr && predicate(*pollAddress, expectedValue);
+}
+
+inline bool adaptiveWaitFunction(volatile TagAddressType *pollAddress, TaskCountType expectedValue, AdaptiveWaitState::Phase phase) {
+    return adaptiveWaitFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>(), phase);
+}
+
 void init();
 } // namespace WaitUtils
 
@@ -127,6 +127,9 @@ int DrmMockPrelimContext::handlePrelimRequest(DrmIoctl request, void *arg) {
             vmBind->extensions,
         };
         storeVmBindExtensions(vmBind->extensions, true);
+        if (vmBindFailingFromCall && vmBindCalled >= *vmBindFailingFromCall) {
+            return -1;
+        }
         return vmBindReturn;
     } break;
     case DrmIoctl::gemVmUnbind: {
@@ -130,6 +130,7 @@ struct DrmMockPrelimContext {
     std::optional<UuidVmBindExt> receivedVmBindUuidExt[2]{};
     std::optional<uint64_t> receivedVmBindPatIndex{};
     int vmBindReturn{0};
+    std::optional<size_t> vmBindFailingFromCall{};
 
     size_t vmUnbindCalled{0};
     std::optional<VmBindParams> receivedVmUnbind{};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,9 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
+#include <utility>
+#include <vector>
+
 using namespace NEO;
 
 class MockPageFaultManager : public PageFaultManager {
@@ -51,6 +54,14 @@ class MockPageFaultManager : public PageFaultManager {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
     }
+    void transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
+        transferRangeToCpuCalled++;
+        transferredRangesToCpu.push_back({offset, size});
+    }
+    void transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) override {
+        transferRangeToGpuCalled++;
+        transferredRangesToGpu.push_back({offset, size});
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -102,6 +113,8 @@ class MockPageFaultManager : public PageFaultManager {
     int protectMemoryCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
+    int transferRangeToCpuCalled = 0;
+    int transferRangeToGpuCalled = 0;
     int moveAllocationToGpuDomainCalled = 0;
     int setCpuAllocEvictableCalled = 0;
     int allowCPUMemoryEvictionCalled = 0;
@@ -111,6 +124,8 @@ class MockPageFaultManager : public PageFaultManager {
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    std::vector<std::pair<size_t, size_t>> transferredRangesToCpu;
+    std::vector<std::pair<size_t, size_t>> transferredRangesToGpu;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
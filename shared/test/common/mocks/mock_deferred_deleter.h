@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,9 @@
 namespace NEO {
 class MockDeferredDeleter : public DeferredDeleter {
   public:
+    using DeferredDeleter::externalHandlesQueue;
+    using DeferredDeleter::largeAllocationsQueue;
+    using DeferredDeleter::queue;
     using DeferredDeleter::run;
     MockDeferredDeleter();
 
@@ -22,6 +22,7 @@ struct MockSVMAllocsManager : public SVMAllocsManager {
     using SVMAllocsManager::SVMAllocsManager;
     using SVMAllocsManager::svmDeferFreeAllocs;
     using SVMAllocsManager::svmMapOperations;
+    using SVMAllocsManager::unifiedMemoryReuseCleaner;
     using SVMAllocsManager::usmDeviceAllocationsCache;
     using SVMAllocsManager::usmDeviceAllocationsCacheEnabled;
     using SVMAllocsManager::usmHostAllocationsCache;
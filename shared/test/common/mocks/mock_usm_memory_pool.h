@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,4 +15,16 @@ class MockUsmMemAllocPool : public UsmMemAllocPool {
     using UsmMemAllocPool::poolEnd;
     using UsmMemAllocPool::poolMemoryType;
     using UsmMemAllocPool::poolSize;
-};
\ No newline at end of file
+};
+
+class MockUsmMemAllocPoolsManager : public UsmMemAllocPoolsManager {
+  public:
+    using UsmMemAllocPoolsManager::poolIdleTime;
+    using UsmMemAllocPoolsManager::pools;
+
+    std::chrono::steady_clock::time_point getCpuTimestamp() override {
+        return cpuTimestamp;
+    }
+
+    std::chrono::steady_clock::time_point cpuTimestamp{};
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,6 +74,7 @@ extern std::vector<void *> mmapVector;
 extern std::vector<void *> mmapCapturedExtendedPointers;
 extern bool mmapCaptureExtendedPointers;
 extern bool mmapAllowExtendedPointers;
+extern bool failMmap;
 extern uint32_t mmapFuncCalled;
 extern uint32_t munmapFuncCalled;
 
@@ -1841,6 +1841,77 @@ TEST(CommandStreamReceiverSimpleTest, givenEmptyTemporaryAllocationListWhenWaiti
     CpuIntrinsicsTests::pauseAddress = nullptr;
 }
 
+TEST(CommandStreamReceiverSimpleTest, givenAdaptiveWaitPolicyWhenWaitingForTaskCountThenCompletedWaitIsRecordedInCsrWaitStatistics) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableWaitpkg.set(0);
+    VariableBackup<WaitUtils::WaitPolicy> backupWaitPolicy(&WaitUtils::waitPolicy, WaitUtils::WaitPolicy::adaptive);
+    VariableBackup<int64_t> backupSpinTime(&WaitUtils::adaptiveSpinTime, std::numeric_limits<int64_t>::max());
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+
+    csr.mockTagAddress[0] = 0u;
+    csr.taskCount = 3u;
+    csr.latestFlushedTaskCount = 3u;
+
+    VariableBackup<volatile TagAddressType *> backupPauseAddress(&CpuIntrinsicsTests::pauseAddress);
+    VariableBackup<TaskCountType> backupPauseValue(&CpuIntrinsicsTests::pauseValue);
+    VariableBackup<uint32_t> backupPauseOffset(&CpuIntrinsicsTests::pauseOffset);
+
+    CpuIntrinsicsTests::pauseAddress = &csr.mockTagAddress[0];
+    CpuIntrinsicsTests::pauseValue = 3u;
+
+    WaitParams waitParams{false, false, 0};
+    EXPECT_EQ(WaitStatus::ready, csr.baseWaitFunction(csr.getTagAddress(), waitParams, 3u));
+
+    auto statistics = csr.getAdaptiveWaitState().getStatistics();
+    EXPECT_EQ(1u, statistics.waits);
+    EXPECT_EQ(1u, statistics.completions[static_cast<uint32_t>(WaitUtils::AdaptiveWaitState::Phase::spin)]);
+
+    EXPECT_EQ(WaitStatus::ready, csr.baseWaitFunction(csr.getTagAddress(), waitParams, 3u));
+    EXPECT_EQ(1u, csr.getAdaptiveWaitState().getStatistics().waits);
+
+    CpuIntrinsicsTests::pauseAddress = nullptr;
+}
+
+TEST(CommandStreamReceiverSimpleTest, givenAdaptiveWaitPolicyWhenWaitingIndefinitelyForTaskCountThenAdaptiveWaiterIsUsedAndWaitIsRecorded) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableWaitpkg.set(0);
+    VariableBackup<WaitUtils::WaitPolicy> backupWaitPolicy(&WaitUtils::waitPolicy, WaitUtils::WaitPolicy::adaptive);
+    VariableBackup<int64_t> backupSpinTime(&WaitUtils::adaptiveSpinTime, 0);
+    VariableBackup<int64_t> backupSleepTime(&WaitUtils::adaptiveSleepTime, std::numeric_limits<int32_t>::max());
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+
+    csr.mockTagAddress[0] = 0u;
+    csr.taskCount = 3u;
+    csr.latestFlushedTaskCount = 3u;
+
+    VariableBackup<volatile TagAddressType *> backupPauseAddress(&CpuIntrinsicsTests::pauseAddress);
+    VariableBackup<TaskCountType> backupPauseValue(&CpuIntrinsicsTests::pauseValue);
+    VariableBackup<uint32_t> backupPauseOffset(&CpuIntrinsicsTests::pauseOffset);
+
+    CpuIntrinsicsTests::pauseAddress = &csr.mockTagAddress[0];
+    CpuIntrinsicsTests::pauseValue = 3u;
+
+    WaitParams waitParams{true, false, 0};
+    EXPECT_EQ(WaitStatus::ready, csr.baseWaitFunction(csr.getTagAddress(), waitParams, 3u));
+
+    auto statistics = csr.getAdaptiveWaitState().getStatistics();
+    EXPECT_EQ(1u, statistics.waits);
+    EXPECT_EQ(0u, statistics.completions[static_cast<uint32_t>(WaitUtils::AdaptiveWaitState::Phase::spin)]);
+    EXPECT_EQ(1u, statistics.completions[static_cast<uint32_t>(WaitUtils::AdaptiveWaitState::Phase::monitor)]);
+
+    CpuIntrinsicsTests::pauseAddress = nullptr;
+}
+
 TEST(CommandStreamReceiverMultiContextTests, givenMultipleCsrsWhenSameResourcesAreUsedThenResidencyIsProperlyHandled) {
     std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get(), 0u));
 
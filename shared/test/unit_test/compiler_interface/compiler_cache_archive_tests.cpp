@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_archive.h"
+#include "shared/source/helpers/constants.h"
+
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+class CompilerCacheArchiveUnderTest : public CompilerCacheArchive {
+  public:
+    using CompilerCacheArchive::CompilerCacheArchive;
+    using CompilerCacheArchive::header;
+};
+
+struct CompilerCacheArchiveTest : public ::testing::Test {
+    void SetUp() override {
+        memory.resize(CompilerCacheArchive::getRequiredSize(indexEntriesCount, dataCapacity));
+        archive = std::make_unique<CompilerCacheArchiveUnderTest>(memory.data(), memory.size(), indexEntriesCount, dataCapacity);
+    }
+
+    std::string makeKey(uint32_t id) {
+        return "0123456789abcdef" + std::to_string(id);
+    }
+
+    static constexpr uint32_t indexEntriesCount = 1024u;
+    static constexpr size_t dataCapacity = 4096u;
+    std::vector<char> memory;
+    std::unique_ptr<CompilerCacheArchiveUnderTest> archive;
+};
+} // namespace
+
+TEST(CompilerCacheArchiveSizeTest, givenDataCapacityWhenGettingIndexEntriesCountThenPowerOfTwoWithinLimitsIsReturned) {
+    EXPECT_EQ(CompilerCacheArchive::minIndexEntries, CompilerCacheArchive::getIndexEntriesCount(0u));
+    EXPECT_EQ(CompilerCacheArchive::minIndexEntries, CompilerCacheArchive::getIndexEntriesCount(MemoryConstants::megaByte));
+    EXPECT_EQ(16384u, CompilerCacheArchive::getIndexEntriesCount(MemoryConstants::gigaByte));
+    EXPECT_EQ(CompilerCacheArchive::maxIndexEntries, CompilerCacheArchive::getIndexEntriesCount(std::numeric_limits<size_t>::max() / 2));
+}
+
+TEST_F(CompilerCacheArchiveTest, givenNotFormattedMemoryWhenLoadingThenNullptrIsReturned) {
+    EXPECT_FALSE(archive->isFormatted());
+
+    size_t size = 1u;
+    EXPECT_EQ(nullptr, archive->load(makeKey(0), size));
+    EXPECT_EQ(0u, size);
+}
+
+TEST_F(CompilerCacheArchiveTest, givenNotFormattedMemoryWhenStoringThenArchiveIsFormattedAndBinaryCanBeLoaded) {
+    const char binary[] = "binary";
+    EXPECT_TRUE(archive->store(makeKey(0), binary, sizeof(binary)));
+    EXPECT_TRUE(archive->isFormatted());
+    EXPECT_EQ(1u, archive->getUsedEntries());
+    EXPECT_EQ(sizeof(binary), archive->getUsedBytes());
+
+    size_t size = 0u;
+    auto loaded = archive->load(makeKey(0), size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loaded.get(), size));
+
+    EXPECT_EQ(nullptr, archive->load(makeKey(1), size));
+}
+
+TEST_F(CompilerCacheArchiveTest, givenFormattedArchiveWhenNewArchiveIsCreatedOnSameMemoryThenStoredBinariesAreVisible) {
+    const char binary[] = "binary";
+    EXPECT_TRUE(archive->store(makeKey(0), binary, sizeof(binary)));
+
+    CompilerCacheArchiveUnderTest secondArchive(memory.data(), memory.size(), indexEntriesCount, dataCapacity);
+    EXPECT_TRUE(secondArchive.isFormatted());
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, secondArchive.load(makeKey(0), size));
+    EXPECT_EQ(sizeof(binary), size);
+}
+
+TEST_F(CompilerCacheArchiveTest, givenArchiveWithDifferentLayoutWhenOpenedThenLayoutOfArchiveIsUsed) {
+    const char binary[] = "binary";
+    EXPECT_TRUE(archive->store(makeKey(0), binary, sizeof(binary)));
+
+    CompilerCacheArchiveUnderTest smallerArchive(memory.data(), memory.size(), indexEntriesCount, dataCapacity / 2);
+    EXPECT_TRUE(smallerArchive.isFormatted());
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, smallerArchive.load(makeKey(0), size));
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(dataCapacity, smallerArchive.getDataCapacity());
+
+    EXPECT_TRUE(smallerArchive.store(makeKey(1), binary, sizeof(binary)));
+    EXPECT_EQ(dataCapacity, smallerArchive.header->dataCapacity);
+    EXPECT_EQ(2u, smallerArchive.getUsedEntries());
+}
+
+TEST_F(CompilerCacheArchiveTest, givenArchiveLayoutNotFittingInMemoryWhenOpenedThenItIsNotFormattedAndStoreFormatsItWithRequestedLayout) {
+    const char binary[] = "binary";
+    EXPECT_TRUE(archive->store(makeKey(0), binary, sizeof(binary)));
+    archive->header->dataCapacity = dataCapacity * 2;
+
+    CompilerCacheArchiveUnderTest secondArchive(memory.data(), memory.size(), indexEntriesCount, dataCapacity);
+    EXPECT_FALSE(secondArchive.isFormatted());
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, secondArchive.load(makeKey(0), size));
+
+    EXPECT_TRUE(secondArchive.store(makeKey(1), binary, sizeof(binary)));
+    EXPECT_TRUE(secondArchive.isFormatted());
+    EXPECT_EQ(dataCapacity, secondArchive.header->dataCapacity);
+    EXPECT_EQ(1u, secondArchive.getUsedEntries());
+}
+
+TEST_F(CompilerCacheArchiveTest, givenInvalidInputWhenStoringThenFalseIsReturned) {
+    const char binary[] = "binary";
+    EXPECT_FALSE(archive->store(makeKey(0), nullptr, sizeof(binary)));
+    EXPECT_FALSE(archive->store(makeKey(0), binary, 0u));
+
+    std::vector<char> tooBig(dataCapacity + 1);
+    EXPECT_FALSE(archive->store(makeKey(0), tooBig.data(), tooBig.size()));
+
+    std::string tooLongKey(CompilerCacheArchive::maxKeyLength + 1, 'a');
+    EXPECT_FALSE(archive->store(tooLongKey, binary, sizeof(binary)));
+}
+
+TEST_F(CompilerCacheArchiveTest, givenAlreadyStoredKeyWhenStoringAgainThenDataIsNotDuplicated) {
+    const char binary[] = "binary";
+    EXPECT_TRUE(archive->store(makeKey(0), binary, sizeof(binary)));
+    auto writeOffset = archive->header->writeOffset;
+
+    EXPECT_TRUE(archive->store(makeKey(0), binary, sizeof(binary)));
+    EXPECT_EQ(1u, archive->getUsedEntries());
+    EXPECT_EQ(writeOffset, archive->header->writeOffset);
+}
+
+TEST_F(CompilerCacheArchiveTest, givenFullDataLogWhenStoringThenOnlyOverwrittenEntriesAreEvicted) {
+    std::vector<char> binary(1024u - sizeof(CompilerCacheArchive::RecordHeader), 'x');
+    for (uint32_t i = 0; i < 4; i++) {
+        EXPECT_TRUE(archive->store(makeKey(i), binary.data(), binary.size()));
+    }
+    EXPECT_EQ(4u, archive->getUsedEntries());
+
+    EXPECT_TRUE(archive->store(makeKey(4), binary.data(), binary.size()));
+    EXPECT_EQ(4u, archive->getUsedEntries());
+    EXPECT_EQ(4u * binary.size(), archive->getUsedBytes());
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, archive->load(makeKey(0), size));
+    EXPECT_NE(nullptr, archive->load(makeKey(2), size));
+    EXPECT_NE(nullptr, archive->load(makeKey(3), size));
+    EXPECT_NE(nullptr, archive->load(makeKey(4), size));
+}
+
+TEST_F(CompilerCacheArchiveTest, givenEntryAboutToBeOverwrittenWhenLoadedThenItIsMovedToLogTailAndSurvivesNextStore) {
+    std::vector<char> binary(1024u - sizeof(CompilerCacheArchive::RecordHeader), 'x');
+    for (uint32_t i = 0; i < 4; i++) {
+        EXPECT_TRUE(archive->store(makeKey(i), binary.data(), binary.size()));
+    }
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, archive->load(makeKey(0), size));
+
+    EXPECT_TRUE(archive->store(makeKey(4), binary.data(), binary.size()));
+
+    EXPECT_NE(nullptr, archive->load(makeKey(0), size));
+    EXPECT_EQ(binary.size(), size);
+    EXPECT_EQ(4u, archive->getUsedEntries());
+}
+
+TEST_F(CompilerCacheArchiveTest, givenWrappedDataLogWhenStoringSmallBinariesThenPreviousLapIsEvictedIncrementally) {
+    std::vector<char> binary(1024u - sizeof(CompilerCacheArchive::RecordHeader), 'x');
+    for (uint32_t i = 0; i < 4; i++) {
+        EXPECT_TRUE(archive->store(makeKey(i), binary.data(), binary.size()));
+    }
+    EXPECT_EQ(dataCapacity, archive->header->writeOffset);
+
+    const char smallBinary[] = "binary";
+    EXPECT_TRUE(archive->store(makeKey(4), smallBinary, sizeof(smallBinary)));
+    EXPECT_EQ(dataCapacity, archive->header->previousLapEnd);
+    EXPECT_EQ(1024u, archive->header->evictOffset);
+    EXPECT_EQ(CompilerCacheArchive::getRecordSize(sizeof(smallBinary)), archive->header->writeOffset);
+    EXPECT_EQ(4u, archive->getUsedEntries());
+
+    const auto smallRecordsPerBigRecord = static_cast<uint32_t>(1024u / CompilerCacheArchive::getRecordSize(sizeof(smallBinary)));
+    for (uint32_t i = 5; i < 4 + smallRecordsPerBigRecord; i++) {
+        EXPECT_TRUE(archive->store(makeKey(i), smallBinary, sizeof(smallBinary)));
+    }
+    EXPECT_EQ(1024u, archive->header->evictOffset);
+    EXPECT_EQ(1024u, archive->header->writeOffset);
+
+    EXPECT_TRUE(archive->store(makeKey(1024u), smallBinary, sizeof(smallBinary)));
+    EXPECT_EQ(2048u, archive->header->evictOffset);
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, archive->load(makeKey(1), size));
+    EXPECT_NE(nullptr, archive->load(makeKey(3), size));
+    EXPECT_NE(nullptr, archive->load(makeKey(4), size));
+}
+
+TEST_F(CompilerCacheArchiveTest, givenManyStoresWhenRemovedEntriesAccumulateThenIndexIsRebuiltAndLookupsStillWork) {
+    const char binary[] = "binary";
+    for (uint32_t i = 0; i < 4 * indexEntriesCount; i++) {
+        EXPECT_TRUE(archive->store(makeKey(i), binary, sizeof(binary)));
+    }
+    EXPECT_LE((archive->getUsedEntries() + archive->header->removedEntries) * 4, indexEntriesCount * 3);
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, archive->load(makeKey(4 * indexEntriesCount - 1), size));
+    EXPECT_EQ(sizeof(binary), size);
+}
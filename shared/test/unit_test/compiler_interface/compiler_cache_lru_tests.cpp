@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_lru.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(CompilerCacheLruTest, givenEmptyCacheWhenLoadingThenNullptrIsReturnedAndMissIsCounted) {
+    CompilerCacheLru cache(1024u);
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, cache.load("hash", size));
+    EXPECT_EQ(0u, size);
+    EXPECT_EQ(0u, cache.getHits());
+    EXPECT_EQ(1u, cache.getMisses());
+}
+
+TEST(CompilerCacheLruTest, givenStoredBinaryWhenLoadingThenCopyIsReturnedAndHitIsCounted) {
+    CompilerCacheLru cache(1024u);
+    const char binary[] = "binary";
+    cache.store("hash", binary, sizeof(binary));
+    EXPECT_EQ(1u, cache.getNumEntries());
+    EXPECT_EQ(sizeof(binary), cache.getUsedBytes());
+
+    size_t size = 0u;
+    auto loaded = cache.load("hash", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loaded.get(), size));
+    EXPECT_NE(static_cast<const void *>(binary), static_cast<const void *>(loaded.get()));
+    EXPECT_EQ(1u, cache.getHits());
+    EXPECT_EQ(0u, cache.getMisses());
+}
+
+TEST(CompilerCacheLruTest, givenInvalidOrTooBigBinaryWhenStoringThenItIsNotCached) {
+    CompilerCacheLru cache(4u);
+    const char binary[] = "binary";
+    cache.store("hash0", nullptr, 4u);
+    cache.store("hash1", binary, 0u);
+    cache.store("hash2", binary, sizeof(binary));
+    EXPECT_EQ(0u, cache.getNumEntries());
+    EXPECT_EQ(0u, cache.getUsedBytes());
+}
+
+TEST(CompilerCacheLruTest, givenAlreadyStoredHashWhenStoringAgainThenEntryIsNotDuplicated) {
+    CompilerCacheLru cache(1024u);
+    const char binary[] = "binary";
+    cache.store("hash", binary, sizeof(binary));
+    cache.store("hash", binary, sizeof(binary));
+    EXPECT_EQ(1u, cache.getNumEntries());
+    EXPECT_EQ(sizeof(binary), cache.getUsedBytes());
+}
+
+TEST(CompilerCacheLruTest, givenFullCacheWhenStoringThenLeastRecentlyUsedEntriesAreEvicted) {
+    std::vector<char> binary(256u, 'x');
+    CompilerCacheLru cache(3 * binary.size());
+
+    cache.store("hash0", binary.data(), binary.size());
+    cache.store("hash1", binary.data(), binary.size());
+    cache.store("hash2", binary.data(), binary.size());
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, cache.load("hash0", size));
+
+    cache.store("hash3", binary.data(), binary.size());
+    EXPECT_EQ(3u, cache.getNumEntries());
+    EXPECT_EQ(3 * binary.size(), cache.getUsedBytes());
+
+    EXPECT_NE(nullptr, cache.load("hash0", size));
+    EXPECT_EQ(nullptr, cache.load("hash1", size));
+    EXPECT_NE(nullptr, cache.load("hash2", size));
+    EXPECT_NE(nullptr, cache.load("hash3", size));
+}
+
+TEST(CompilerCacheLruTest, givenMultipleThreadsWhenStoringAndLoadingThenCountersAreConsistent) {
+    CompilerCacheLru cache(64u * 1024u);
+    const char binary[] = "binary";
+    constexpr uint32_t numThreads = 4u;
+    constexpr uint32_t iterations = 100u;
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&cache, &binary, t]() {
+            for (uint32_t i = 0; i < iterations; i++) {
+                auto hash = std::to_string(t) + "_" + std::to_string(i % 10);
+                size_t size = 0u;
+                if (!cache.load(hash, size)) {
+                    cache.store(hash, binary, sizeof(binary));
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numThreads * iterations, cache.getHits() + cache.getMisses());
+    EXPECT_EQ(numThreads * 10u, cache.getNumEntries());
+    EXPECT_EQ(numThreads * 10u, cache.getMisses());
+}
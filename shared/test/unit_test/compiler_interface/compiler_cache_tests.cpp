@@ -1,14 +1,16 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_lru.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/utilities/io_functions.h"
@@ -226,6 +228,20 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheTests, GivenCompilerCacheWhenGettingCachedFileNameThenVersionedHexEncoded128BitHashIsReturned) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    const char src[] = "__kernel void k() {}";
+    const char revision[] = "revision";
+
+    CompilerCache cache(CompilerCacheConfig{});
+    auto hash = cache.getCachedFileName(hwInfo, ArrayRef<const char>(src, sizeof(src)), ArrayRef<const char>(), ArrayRef<const char>(),
+                                        ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(revision, sizeof(revision)), 0u, 0);
+
+    EXPECT_EQ(2u, CompilerCache::cacheKeyVersion);
+    EXPECT_EQ(2 * sizeof(Hash128Value), hash.size());
+    EXPECT_EQ(std::string::npos, hash.find_first_not_of("0123456789abcdef"));
+}
+
 TEST(CompilerCacheTests, GivenBinaryCacheWhenDebugFlagIsSetThenTraceFilesAreCreated) {
     DebugManagerStateRestore restorer;
     debugManager.flags.BinaryCacheTrace.set(true);
@@ -335,6 +351,123 @@ TEST(CompilerCacheTests, GivenNonExistantConfigWhenLoadingFromCacheThenNullIsRet
     EXPECT_EQ(0U, size);
 }
 
+namespace {
+class CompilerCacheWithDiskCounters : public CompilerCache {
+  public:
+    CompilerCacheWithDiskCounters() : CompilerCache(CompilerCacheConfig{}) {}
+
+    bool cacheBinaryOnDisk(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) override {
+        cacheBinaryOnDiskCalled++;
+        return true;
+    }
+
+    std::unique_ptr<char[]> loadCachedBinaryFromDisk(const std::string &kernelFileHash, size_t &cachedBinarySize) override {
+        loadCachedBinaryFromDiskCalled++;
+        if (!diskHasBinary) {
+            cachedBinarySize = 0u;
+            return nullptr;
+        }
+        cachedBinarySize = 4u;
+        auto binary = std::make_unique<char[]>(cachedBinarySize);
+        memcpy_s(binary.get(), cachedBinarySize, "disk", cachedBinarySize);
+        return binary;
+    }
+
+    uint32_t cacheBinaryOnDiskCalled = 0u;
+    uint32_t loadCachedBinaryFromDiskCalled = 0u;
+    bool diskHasBinary = false;
+};
+} // namespace
+
+TEST(CompilerCacheTests, givenDefaultSettingsWhenCompilerCacheIsCreatedThenInMemoryCacheIsNotCreated) {
+    EXPECT_EQ(0u, CompilerCache::defaultInMemoryCacheSize);
+    CompilerCache cache(CompilerCacheConfig{});
+    EXPECT_EQ(nullptr, cache.getInMemoryCache());
+}
+
+TEST(CompilerCacheTests, givenCompilerCacheInMemorySizeDebugFlagWhenCompilerCacheIsCreatedThenInMemoryCacheSizeIsOverridden) {
+    DebugManagerStateRestore restorer;
+
+    debugManager.flags.CompilerCacheInMemorySize.set(0);
+    CompilerCache disabledCache(CompilerCacheConfig{});
+    EXPECT_EQ(nullptr, disabledCache.getInMemoryCache());
+
+    debugManager.flags.CompilerCacheInMemorySize.set(4096);
+    CompilerCache cache(CompilerCacheConfig{});
+    ASSERT_NE(nullptr, cache.getInMemoryCache());
+    EXPECT_EQ(4096u, cache.getInMemoryCache()->getCapacity());
+}
+
+TEST(CompilerCacheTests, givenCachedBinaryWhenLoadingThenItIsReturnedFromMemoryWithoutDiskAccess) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CompilerCacheInMemorySize.set(4096);
+
+    CompilerCacheWithDiskCounters cache;
+    const char binary[] = "binary";
+    EXPECT_TRUE(cache.cacheBinary("hash", binary, sizeof(binary)));
+    EXPECT_EQ(1u, cache.cacheBinaryOnDiskCalled);
+
+    size_t size = 0u;
+    auto loaded = cache.loadCachedBinary("hash", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loaded.get(), size));
+    EXPECT_EQ(0u, cache.loadCachedBinaryFromDiskCalled);
+    EXPECT_EQ(1u, cache.getInMemoryCache()->getHits());
+}
+
+TEST(CompilerCacheTests, givenBinaryOnlyOnDiskWhenLoadedTwiceThenDiskIsAccessedOnce) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CompilerCacheInMemorySize.set(4096);
+
+    CompilerCacheWithDiskCounters cache;
+    cache.diskHasBinary = true;
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, cache.loadCachedBinary("hash", size));
+    EXPECT_EQ(4u, size);
+    EXPECT_EQ(1u, cache.loadCachedBinaryFromDiskCalled);
+    EXPECT_EQ(1u, cache.getInMemoryCache()->getMisses());
+
+    size = 0u;
+    auto loaded = cache.loadCachedBinary("hash", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(4u, size);
+    EXPECT_EQ(0, memcmp("disk", loaded.get(), size));
+    EXPECT_EQ(1u, cache.loadCachedBinaryFromDiskCalled);
+    EXPECT_EQ(1u, cache.getInMemoryCache()->getHits());
+}
+
+TEST(CompilerCacheTests, givenInMemoryCacheDisabledWhenLoadingCachedBinaryThenDiskIsAlwaysAccessed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CompilerCacheInMemorySize.set(0);
+
+    CompilerCacheWithDiskCounters cache;
+    cache.diskHasBinary = true;
+    const char binary[] = "binary";
+    EXPECT_TRUE(cache.cacheBinary("hash", binary, sizeof(binary)));
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, cache.loadCachedBinary("hash", size));
+    EXPECT_NE(nullptr, cache.loadCachedBinary("hash", size));
+    EXPECT_EQ(2u, cache.loadCachedBinaryFromDiskCalled);
+}
+
+TEST(CompilerCacheTests, givenPrintCompilerCacheInMemoryStatisticsWhenCompilerCacheIsDestroyedThenCountersArePrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintCompilerCacheInMemoryStatistics.set(true);
+    debugManager.flags.CompilerCacheInMemorySize.set(4096);
+
+    testing::internal::CaptureStdout();
+    {
+        CompilerCacheWithDiskCounters cache;
+        size_t size = 0u;
+        cache.loadCachedBinary("hash", size);
+    }
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("hits: 0, misses: 1"));
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
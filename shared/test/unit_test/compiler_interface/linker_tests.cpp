@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 
 #include <array>
 #include <string>
+#include <system_error>
 
 TEST(SegmentTypeTests, givenSegmentTypeWhenAsStringIsCalledThenProperRepresentationIsReturned) {
     EXPECT_STREQ("UNKOWN", NEO::asString(NEO::SegmentType::unknown));
@@ -2393,3 +2394,227 @@ TEST_F(LinkerTests, givenPerThreadPayloadOffsetRelocationWhenPatchingInstruction
     auto perThreadPayloadOffsetPatchedValue = reinterpret_cast<uint32_t *>(ptrOffset(segmentToPatch.hostPointer, static_cast<size_t>(rel.offset)));
     EXPECT_EQ(kd.kernelAttributes.crossThreadDataSize, static_cast<uint32_t>(*perThreadPayloadOffsetPatchedValue));
 }
+
+TEST(LinkerInputTests, whenRelocationsAreAddedThenSymbolNamesAreInternedOnce) {
+    NEO::LinkerInput linkerInput;
+    NEO::LinkerInput::RelocationInfo relocation;
+    relocation.type = NEO::LinkerInput::RelocationInfo::Type::address;
+
+    relocation.symbolName = "A";
+    linkerInput.addElfTextSegmentRelocation(relocation, 0u);
+    relocation.symbolName = "B";
+    linkerInput.addElfTextSegmentRelocation(relocation, 1u);
+    relocation.symbolName = "A";
+    linkerInput.addElfTextSegmentRelocation(relocation, 1u);
+    relocation.symbolName = "";
+    linkerInput.addElfTextSegmentRelocation(relocation, 1u);
+    relocation.symbolName = "B";
+    relocation.relocationSegment = NEO::SegmentType::globalVariables;
+    linkerInput.addDataRelocationInfo(relocation);
+
+    const auto &internedSymbolNames = linkerInput.getInternedSymbolNames();
+    ASSERT_EQ(2u, internedSymbolNames.size());
+    EXPECT_EQ("A", internedSymbolNames[0]);
+    EXPECT_EQ("B", internedSymbolNames[1]);
+
+    const auto &textRelocations = linkerInput.getRelocationsInInstructionSegments();
+    EXPECT_EQ(0u, textRelocations[0][0].symbolId);
+    EXPECT_EQ(1u, textRelocations[1][0].symbolId);
+    EXPECT_EQ(0u, textRelocations[1][1].symbolId);
+    EXPECT_EQ(NEO::LinkerInput::invalidSymbolId, textRelocations[1][2].symbolId);
+    EXPECT_EQ(1u, linkerInput.getDataRelocations()[0].symbolId);
+}
+
+TEST(LinkerInputTests, givenRelocationTableWhenDecodingThenSymbolNamesAreInterned) {
+    NEO::LinkerInput linkerInput;
+    vISA::GenRelocEntry relocs[3] = {};
+    relocs[0].r_symbol[0] = 'A';
+    relocs[0].r_type = vISA::GenRelocType::R_SYM_ADDR;
+    relocs[1].r_symbol[0] = 'B';
+    relocs[1].r_type = vISA::GenRelocType::R_SYM_ADDR;
+    relocs[2].r_symbol[0] = 'A';
+    relocs[2].r_type = vISA::GenRelocType::R_SYM_ADDR_32;
+    EXPECT_TRUE(linkerInput.decodeRelocationTable(&relocs, 3, 0));
+
+    const auto &relocations = linkerInput.getRelocationsInInstructionSegments()[0];
+    EXPECT_EQ(2u, linkerInput.getInternedSymbolNames().size());
+    EXPECT_EQ(relocations[0].symbolId, relocations[2].symbolId);
+    EXPECT_NE(relocations[0].symbolId, relocations[1].symbolId);
+}
+
+TEST(ParallelLinkingTests, givenParallelLinkingDebugFlagsWhenGettingLinkingThreadsCountThenFlagsAreRespected) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(1u, NEO::getLinkingThreadsCount(NEO::parallelLinkingMinRelocationsCount - 1, 64u));
+    EXPECT_LE(NEO::getLinkingThreadsCount(NEO::parallelLinkingMinRelocationsCount, 64u), NEO::maxLinkingThreadsCount);
+
+    debugManager.flags.OverrideLinkingThreadsCount.set(4);
+    EXPECT_EQ(4u, NEO::getLinkingThreadsCount(NEO::parallelLinkingMinRelocationsCount, 64u));
+    EXPECT_EQ(2u, NEO::getLinkingThreadsCount(NEO::parallelLinkingMinRelocationsCount, 2u));
+
+    debugManager.flags.EnableParallelLinking.set(0);
+    EXPECT_EQ(1u, NEO::getLinkingThreadsCount(NEO::parallelLinkingMinRelocationsCount, 64u));
+
+    debugManager.flags.EnableParallelLinking.set(1);
+    EXPECT_EQ(4u, NEO::getLinkingThreadsCount(1u, 64u));
+}
+
+TEST_F(LinkerTests, givenManyRelocationsWhenLinkingInParallelThenResultIsIdenticalToSequentialLinking) {
+    constexpr uint32_t segmentsCount = 16u;
+    constexpr uint32_t relocationsPerSegment = 512u;
+    constexpr uint32_t symbolsCount = 64u;
+    constexpr size_t segmentSize = relocationsPerSegment * sizeof(uint64_t);
+
+    NEO::LinkerInput linkerInput;
+    for (uint32_t symbolId = 0u; symbolId < symbolsCount; symbolId++) {
+        NEO::SymbolInfo symbolInfo;
+        symbolInfo.offset = symbolId * sizeof(uint64_t);
+        symbolInfo.size = sizeof(uint64_t);
+        symbolInfo.segment = NEO::SegmentType::globalVariables;
+        symbolInfo.global = true;
+        linkerInput.addSymbol("symbol" + std::to_string(symbolId), symbolInfo);
+    }
+    for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+        for (uint32_t i = 0u; i < relocationsPerSegment; i++) {
+            NEO::LinkerInput::RelocationInfo relocation;
+            relocation.offset = i * sizeof(uint64_t);
+            relocation.addend = segId;
+            relocation.type = (i % 3 == 0) ? NEO::LinkerInput::RelocationInfo::Type::addressLow : NEO::LinkerInput::RelocationInfo::Type::address;
+            if (i % 97 == 0) {
+                relocation.symbolName = "unresolved" + std::to_string(segId);
+            } else if (i % 101 == 0) {
+                relocation.symbolName = NEO::implicitArgsRelocationSymbolName;
+            } else {
+                relocation.symbolName = "symbol" + std::to_string((i * 7 + segId) % symbolsCount);
+            }
+            linkerInput.addElfTextSegmentRelocation(relocation, segId);
+        }
+    }
+
+    NEO::Linker::SegmentInfo globalVariablesSegment;
+    globalVariablesSegment.gpuAddress = 0x100000000;
+    globalVariablesSegment.segmentSize = symbolsCount * sizeof(uint64_t);
+
+    std::vector<KernelDescriptor> kernelDescriptorsStorage(segmentsCount);
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    for (auto &kernelDescriptor : kernelDescriptorsStorage) {
+        kernelDescriptors.push_back(&kernelDescriptor);
+    }
+
+    auto linkWithThreads = [&](int32_t parallelLinking, std::vector<std::vector<uint8_t>> &segmentsData, NEO::Linker::UnresolvedExternals &unresolvedExternals) {
+        DebugManagerStateRestore restorer;
+        debugManager.flags.EnableParallelLinking.set(parallelLinking);
+        debugManager.flags.OverrideLinkingThreadsCount.set(4);
+
+        segmentsData.assign(segmentsCount, std::vector<uint8_t>(segmentSize, 0xcd));
+        NEO::Linker::PatchableSegments instructionsSegments(segmentsCount);
+        for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+            instructionsSegments[segId].hostPointer = segmentsData[segId].data();
+            instructionsSegments[segId].gpuAddress = 0x200000000 + segId * segmentSize;
+            instructionsSegments[segId].segmentSize = segmentSize;
+        }
+
+        NEO::Linker linker(linkerInput);
+        NEO::Linker::ExternalFunctionsT externalFunctions;
+        return linker.link(globalVariablesSegment, {}, {}, {}, nullptr, nullptr, instructionsSegments, unresolvedExternals,
+                           pDevice, nullptr, 0, nullptr, 0, kernelDescriptors, externalFunctions);
+    };
+
+    std::vector<std::vector<uint8_t>> sequentialSegmentsData;
+    NEO::Linker::UnresolvedExternals sequentialUnresolvedExternals;
+    auto sequentialResult = linkWithThreads(0, sequentialSegmentsData, sequentialUnresolvedExternals);
+
+    std::vector<std::vector<uint8_t>> parallelSegmentsData;
+    NEO::Linker::UnresolvedExternals parallelUnresolvedExternals;
+    auto parallelResult = linkWithThreads(1, parallelSegmentsData, parallelUnresolvedExternals);
+
+    EXPECT_EQ(NEO::LinkingStatus::linkedPartially, sequentialResult);
+    EXPECT_EQ(sequentialResult, parallelResult);
+    EXPECT_EQ(sequentialSegmentsData, parallelSegmentsData);
+    ASSERT_EQ(segmentsCount * (1u + (relocationsPerSegment - 1) / 97), sequentialUnresolvedExternals.size());
+    ASSERT_EQ(sequentialUnresolvedExternals.size(), parallelUnresolvedExternals.size());
+    for (size_t i = 0u; i < sequentialUnresolvedExternals.size(); i++) {
+        EXPECT_EQ(sequentialUnresolvedExternals[i].instructionsSegmentId, parallelUnresolvedExternals[i].instructionsSegmentId);
+        EXPECT_EQ(sequentialUnresolvedExternals[i].unresolvedRelocation.offset, parallelUnresolvedExternals[i].unresolvedRelocation.offset);
+        EXPECT_EQ(sequentialUnresolvedExternals[i].unresolvedRelocation.symbolName, parallelUnresolvedExternals[i].unresolvedRelocation.symbolName);
+    }
+
+    auto patchedValue = *reinterpret_cast<uint64_t *>(sequentialSegmentsData[1].data() + sizeof(uint64_t));
+    EXPECT_EQ(globalVariablesSegment.gpuAddress + ((7u + 1u) % symbolsCount) * sizeof(uint64_t) + 1u, patchedValue);
+}
+
+TEST_F(LinkerTests, givenThreadCreationFailureWhenLinkingInParallelThenRemainingSegmentsArePatchedByCallingThread) {
+    struct LinkerWithFailingWorkers : public NEO::Linker {
+        using NEO::Linker::Linker;
+        void startLinkingWorker(std::vector<std::thread> &workers, const std::function<void()> &work) override {
+            if (startedWorkers == workersToStart) {
+                throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again));
+            }
+            startedWorkers++;
+            NEO::Linker::startLinkingWorker(workers, work);
+        }
+        uint32_t workersToStart = 0u;
+        uint32_t startedWorkers = 0u;
+    };
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableParallelLinking.set(1);
+    debugManager.flags.OverrideLinkingThreadsCount.set(4);
+
+    constexpr uint32_t segmentsCount = 8u;
+    constexpr uint32_t relocationsPerSegment = 4u;
+    constexpr size_t segmentSize = relocationsPerSegment * sizeof(uint64_t);
+
+    NEO::LinkerInput linkerInput;
+    NEO::SymbolInfo symbolInfo;
+    symbolInfo.offset = 0u;
+    symbolInfo.size = sizeof(uint64_t);
+    symbolInfo.segment = NEO::SegmentType::globalVariables;
+    symbolInfo.global = true;
+    linkerInput.addSymbol("symbol", symbolInfo);
+    for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+        for (uint32_t i = 0u; i < relocationsPerSegment; i++) {
+            NEO::LinkerInput::RelocationInfo relocation;
+            relocation.offset = i * sizeof(uint64_t);
+            relocation.addend = segId;
+            relocation.type = NEO::LinkerInput::RelocationInfo::Type::address;
+            relocation.symbolName = "symbol";
+            linkerInput.addElfTextSegmentRelocation(relocation, segId);
+        }
+    }
+
+    NEO::Linker::SegmentInfo globalVariablesSegment;
+    globalVariablesSegment.gpuAddress = 0x100000000;
+    globalVariablesSegment.segmentSize = sizeof(uint64_t);
+
+    std::vector<KernelDescriptor> kernelDescriptorsStorage(segmentsCount);
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    for (auto &kernelDescriptor : kernelDescriptorsStorage) {
+        kernelDescriptors.push_back(&kernelDescriptor);
+    }
+
+    for (uint32_t workersToStart : {0u, 1u}) {
+        std::vector<std::vector<uint8_t>> segmentsData(segmentsCount, std::vector<uint8_t>(segmentSize, 0xcd));
+        NEO::Linker::PatchableSegments instructionsSegments(segmentsCount);
+        for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+            instructionsSegments[segId].hostPointer = segmentsData[segId].data();
+            instructionsSegments[segId].gpuAddress = 0x200000000 + segId * segmentSize;
+            instructionsSegments[segId].segmentSize = segmentSize;
+        }
+
+        LinkerWithFailingWorkers linker(linkerInput);
+        linker.workersToStart = workersToStart;
+        NEO::Linker::UnresolvedExternals unresolvedExternals;
+        NEO::Linker::ExternalFunctionsT externalFunctions;
+        auto linkResult = linker.link(globalVariablesSegment, {}, {}, {}, nullptr, nullptr, instructionsSegments, unresolvedExternals,
+                                      pDevice, nullptr, 0, nullptr, 0, kernelDescriptors, externalFunctions);
+        EXPECT_EQ(NEO::LinkingStatus::linkedFully, linkResult);
+        EXPECT_TRUE(unresolvedExternals.empty());
+        EXPECT_EQ(workersToStart, linker.startedWorkers);
+
+        for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+            for (uint32_t i = 0u; i < relocationsPerSegment; i++) {
+                EXPECT_EQ(globalVariablesSegment.gpuAddress + segId, reinterpret_cast<uint64_t *>(segmentsData[segId].data())[i]);
+            }
+        }
+    }
+}
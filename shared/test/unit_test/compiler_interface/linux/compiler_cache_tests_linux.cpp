@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1061,3 +1061,73 @@ TEST(CompilerCacheHelper, GivenNotExistingPathWhenGettingFileSizeThenZeroIsRetur
 
     EXPECT_EQ(getFileSize("/tmp/file1"), 0u);
 }
+
+TEST(CompilerCacheTests, GivenEnableCompilerCacheArchiveDebugFlagWhenCompilerCacheIsCreatedThenArchiveModeIsSelected) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableCompilerCacheArchive.set(1);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_TRUE(cache.getConfig().useArchive);
+
+    debugManager.flags.EnableCompilerCacheArchive.set(0);
+    CompilerCacheMockLinux cacheWithoutArchive({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte, true});
+    EXPECT_FALSE(cacheWithoutArchive.getConfig().useArchive);
+}
+
+TEST(CompilerCacheTests, GivenArchiveModeWhenArchiveFileCannotBeOpenedThenCacheBinaryAndLoadCachedBinaryFail) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int { return -1; });
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte, true});
+
+    EXPECT_FALSE(cache.cacheBinary("0123456789abcdef", "1", 1));
+
+    size_t size = 1u;
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("0123456789abcdef", size));
+    EXPECT_EQ(0u, size);
+}
+
+class CompilerCacheArchiveMockLinux : public CompilerCache {
+  public:
+    CompilerCacheArchiveMockLinux(const CompilerCacheConfig &config) : CompilerCache(config) {}
+    using CompilerCache::openArchive;
+};
+
+TEST(CompilerCacheTests, GivenArchiveModeWhenMappingArchiveFailsThenArchiveIsNotUsedAndFileIsClosed) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int { return NEO::SysCalls::fakeFileDescriptor; });
+    VariableBackup<decltype(NEO::SysCalls::failMmap)> mmapBackup(&NEO::SysCalls::failMmap, true);
+    VariableBackup<decltype(NEO::SysCalls::closeFuncArgPassed)> closeBackup(&NEO::SysCalls::closeFuncArgPassed, 0);
+
+    CompilerCacheArchiveMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte, true});
+
+    EXPECT_FALSE(cache.openArchive());
+    EXPECT_EQ(NEO::SysCalls::fakeFileDescriptor, NEO::SysCalls::closeFuncArgPassed);
+}
+
+TEST(CompilerCacheTests, GivenArchiveModeWhenBinaryIsCachedThenItIsLoadedFromArchiveWithoutPerFileAccess) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CompilerCacheInMemorySize.set(0);
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int {
+        EXPECT_NE(std::string_view(pathname).find("cache_archive_cl_cache"), std::string_view::npos);
+        return NEO::SysCalls::fakeFileDescriptor;
+    });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsStat)> statBackup(&NEO::SysCalls::sysCallsStat, [](const std::string &filePath, struct stat *statbuf) -> int {
+        ADD_FAILURE();
+        return -1;
+    });
+    VariableBackup<decltype(NEO::SysCalls::mmapFuncCalled)> mmapCalledBackup(&NEO::SysCalls::mmapFuncCalled, 0u);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte, true});
+
+    const char binary[] = "12345";
+    EXPECT_TRUE(cache.cacheBinary("0123456789abcdef", binary, sizeof(binary)));
+
+    size_t size = 0u;
+    auto loadedBinary = cache.loadCachedBinary("0123456789abcdef", size);
+    ASSERT_NE(nullptr, loadedBinary);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loadedBinary.get(), size));
+
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("fedcba9876543210", size));
+    EXPECT_EQ(1u, NEO::SysCalls::mmapFuncCalled);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -3020,3 +3020,54 @@ TEST(ReserveBasedOnEstimates, WhenContainerFullThenGrowBasedOnPos) {
     EXPECT_TRUE(reservedAdditionalMem);
     EXPECT_EQ(280U, container.capacity());
 }
+
+TEST(YamlCountNewLines, GivenTextThenCountMatchesScalarReference) {
+    std::string text = "kernels:\n  - name: k0\n\n\n    values: [1, 2, 3]\n\t# comment . here\r\n  -   x:   'a b'\n";
+    for (size_t begin = 0; begin < 9; begin++) {
+        for (size_t end = begin; end <= text.size(); end++) {
+            ConstStringRef substr(text.data() + begin, end - begin);
+            size_t expected = 0U;
+            for (auto c : substr) {
+                expected += ('\n' == c) ? 1U : 0U;
+            }
+            EXPECT_EQ(expected, countNewLines(substr)) << begin << ":" << end;
+        }
+    }
+}
+
+TEST(YamlTokenize, GivenLargeTextThenLinesAndNodesAreSizedUpFrontAndNeverReallocated) {
+    std::string yaml = "kernels:\n";
+    for (int i = 0; i < 1000; i++) {
+        yaml += "  - name: kernel_" + std::to_string(i) + "\n    execution_env:\n      simd_size: 32\n      required_work_group_size: [8, 1, 1]\n      version: 1.5 # comment\n";
+    }
+
+    LinesCache lines;
+    TokensCache tokens;
+    std::string errReason, warning;
+    EXPECT_TRUE(tokenize(yaml, lines, tokens, errReason, warning));
+    EXPECT_TRUE(errReason.empty()) << errReason;
+    EXPECT_TRUE(warning.empty()) << warning;
+    EXPECT_EQ(countNewLines(yaml) + 1U, lines.capacity());
+
+    auto maxNodesCount = getMaxNodesCount(lines);
+    NodesCache nodes;
+    EXPECT_TRUE(buildTree(lines, tokens, nodes, errReason, warning));
+    EXPECT_TRUE(errReason.empty()) << errReason;
+    EXPECT_EQ(maxNodesCount, nodes.capacity());
+    EXPECT_LE(nodes.size(), maxNodesCount);
+}
+
+TEST(YamlTokenize, GivenIndentationOfManySpacesThenIndentIsCountedAndInnerSpacesAreSkipped) {
+    ConstStringRef yaml = "a:\n          b:     c    # comment without new line";
+    LinesCache lines;
+    TokensCache tokens;
+    std::string errReason, warning;
+    EXPECT_TRUE(tokenize(yaml, lines, tokens, errReason, warning));
+    EXPECT_TRUE(errReason.empty()) << errReason;
+    ASSERT_EQ(2U, lines.size());
+    EXPECT_EQ(10U, lines[1].indent);
+    ASSERT_EQ(6U, lines[1].last - lines[1].first + 1);
+    EXPECT_EQ("b", tokens[lines[1].first].cstrref());
+    EXPECT_EQ("c", tokens[lines[1].first + 2].cstrref());
+    EXPECT_EQ(" comment without new line", tokens[lines[1].first + 4].cstrref());
+}
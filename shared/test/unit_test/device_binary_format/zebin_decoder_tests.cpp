@@ -10,6 +10,7 @@
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/device_binary_format/zebin/zebin_decoder.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
+#include "shared/source/device_binary_format/zebin/zeinfo_decoder.h"
 #include "shared/source/device_binary_format/zebin/zeinfo_enum_lookup.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -6886,3 +6887,100 @@ TEST(ZeInfoMetadataExtractionFromElf, givenValidElfNotContainingZeInfoSectionWhe
     EXPECT_EQ(nullptr, zeInfoStr32B.data());
     EXPECT_EQ(nullptr, zeInfoStr64B.data());
 }
+
+namespace {
+std::string generateZeInfoWithKernels(uint32_t kernelsCount, const std::vector<uint32_t> &invalidKernels) {
+    std::string zeInfo = "version: '" + versionToString(Zebin::ZeInfo::zeInfoDecoderVersion) + "'\nkernels:\n";
+    for (uint32_t i = 0; i < kernelsCount; i++) {
+        bool isInvalid = std::find(invalidKernels.begin(), invalidKernels.end(), i) != invalidKernels.end();
+        zeInfo += "  - name: kernel" + std::to_string(i) + "\n";
+        zeInfo += "    execution_env:\n";
+        zeInfo += "      simd_size: " + std::string(i % 2 ? "16" : "32") + "\n";
+        zeInfo += "      grf_count: " + (isInvalid ? std::string("abc") : std::to_string(128)) + "\n";
+        zeInfo += "      unknown_entry: " + std::to_string(i) + "\n";
+        zeInfo += "    payload_arguments:\n";
+        zeInfo += "      - arg_type: global_id_offset\n";
+        zeInfo += "        offset: " + std::to_string(4 * i) + "\n";
+        zeInfo += "        size: 12\n";
+    }
+    return zeInfo;
+}
+} // namespace
+
+TEST(DecodeZeInfoKernelsInParallel, givenParallelDecodingModesWhenGettingThreadsCountThenProperValueIsReturned) {
+    DebugManagerStateRestore restorer;
+
+    debugManager.flags.EnableParallelZeInfoDecoding.set(0);
+    EXPECT_EQ(1u, Zebin::ZeInfo::getZeInfoKernelsDecodingThreadsCount(10000u));
+
+    debugManager.flags.EnableParallelZeInfoDecoding.set(-1);
+    debugManager.flags.OverrideZeInfoDecodingThreadsCount.set(4);
+    EXPECT_EQ(1u, Zebin::ZeInfo::getZeInfoKernelsDecodingThreadsCount(Zebin::ZeInfo::parallelDecodingMinKernelsCount - 1));
+    EXPECT_EQ(4u, Zebin::ZeInfo::getZeInfoKernelsDecodingThreadsCount(Zebin::ZeInfo::parallelDecodingMinKernelsCount));
+
+    debugManager.flags.EnableParallelZeInfoDecoding.set(1);
+    EXPECT_EQ(2u, Zebin::ZeInfo::getZeInfoKernelsDecodingThreadsCount(2u));
+    EXPECT_EQ(4u, Zebin::ZeInfo::getZeInfoKernelsDecodingThreadsCount(100u));
+
+    debugManager.flags.OverrideZeInfoDecodingThreadsCount.set(-1);
+    auto threadsCount = Zebin::ZeInfo::getZeInfoKernelsDecodingThreadsCount(100u);
+    EXPECT_LE(1u, threadsCount);
+    EXPECT_GE(Zebin::ZeInfo::maxZeInfoDecodingThreadsCount, threadsCount);
+}
+
+TEST(DecodeZeInfoKernelsInParallel, givenManyKernelsWhenDecodingInParallelThenResultIsIdenticalToSequentialDecoding) {
+    DebugManagerStateRestore restorer;
+    auto zeInfo = generateZeInfoWithKernels(200u, {});
+
+    debugManager.flags.EnableParallelZeInfoDecoding.set(0);
+    NEO::ProgramInfo sequentialProgramInfo;
+    std::string sequentialErrors, sequentialWarnings;
+    auto sequentialError = Zebin::ZeInfo::decodeZeInfo(sequentialProgramInfo, zeInfo, sequentialErrors, sequentialWarnings);
+    EXPECT_EQ(DecodeError::success, sequentialError);
+    EXPECT_FALSE(sequentialWarnings.empty());
+
+    debugManager.flags.EnableParallelZeInfoDecoding.set(1);
+    debugManager.flags.OverrideZeInfoDecodingThreadsCount.set(4);
+    NEO::ProgramInfo parallelProgramInfo;
+    std::string parallelErrors, parallelWarnings;
+    auto parallelError = Zebin::ZeInfo::decodeZeInfo(parallelProgramInfo, zeInfo, parallelErrors, parallelWarnings);
+    EXPECT_EQ(sequentialError, parallelError);
+    EXPECT_EQ(sequentialErrors, parallelErrors);
+    EXPECT_EQ(sequentialWarnings, parallelWarnings);
+
+    ASSERT_EQ(200u, parallelProgramInfo.kernelInfos.size());
+    ASSERT_EQ(sequentialProgramInfo.kernelInfos.size(), parallelProgramInfo.kernelInfos.size());
+    for (size_t i = 0; i < parallelProgramInfo.kernelInfos.size(); i++) {
+        const auto &expected = sequentialProgramInfo.kernelInfos[i]->kernelDescriptor;
+        const auto &actual = parallelProgramInfo.kernelInfos[i]->kernelDescriptor;
+        EXPECT_EQ("kernel" + std::to_string(i), actual.kernelMetadata.kernelName);
+        EXPECT_EQ(expected.kernelMetadata.kernelName, actual.kernelMetadata.kernelName);
+        EXPECT_EQ(expected.kernelAttributes.simdSize, actual.kernelAttributes.simdSize);
+        EXPECT_EQ(expected.kernelAttributes.crossThreadDataSize, actual.kernelAttributes.crossThreadDataSize);
+        EXPECT_EQ(expected.payloadMappings.dispatchTraits.globalWorkOffset[0], actual.payloadMappings.dispatchTraits.globalWorkOffset[0]);
+    }
+}
+
+TEST(DecodeZeInfoKernelsInParallel, givenInvalidKernelsWhenDecodingInParallelThenFirstErrorInKernelOrderIsReportedAndOnlyPrecedingKernelsAreAdded) {
+    DebugManagerStateRestore restorer;
+    auto zeInfo = generateZeInfoWithKernels(100u, {70u, 30u, 90u});
+
+    debugManager.flags.EnableParallelZeInfoDecoding.set(0);
+    NEO::ProgramInfo sequentialProgramInfo;
+    std::string sequentialErrors, sequentialWarnings;
+    auto sequentialError = Zebin::ZeInfo::decodeZeInfo(sequentialProgramInfo, zeInfo, sequentialErrors, sequentialWarnings);
+    EXPECT_EQ(DecodeError::invalidBinary, sequentialError);
+
+    debugManager.flags.EnableParallelZeInfoDecoding.set(1);
+    debugManager.flags.OverrideZeInfoDecodingThreadsCount.set(4);
+    NEO::ProgramInfo parallelProgramInfo;
+    std::string parallelErrors, parallelWarnings;
+    auto parallelError = Zebin::ZeInfo::decodeZeInfo(parallelProgramInfo, zeInfo, parallelErrors, parallelWarnings);
+    EXPECT_EQ(DecodeError::invalidBinary, parallelError);
+    EXPECT_EQ(sequentialErrors, parallelErrors);
+    EXPECT_EQ(sequentialWarnings, parallelWarnings);
+    EXPECT_NE(std::string::npos, parallelErrors.find("kernel30"));
+    EXPECT_EQ(std::string::npos, parallelErrors.find("kernel70"));
+    EXPECT_EQ(30u, parallelProgramInfo.kernelInfos.size());
+    EXPECT_EQ(sequentialProgramInfo.kernelInfos.size(), parallelProgramInfo.kernelInfos.size());
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<char> generateInput(size_t size, uint32_t seed) {
+    std::mt19937 generator(seed);
+    std::vector<char> input(size);
+    for (auto &byte : input) {
+        byte = static_cast<char>(generator());
+    }
+    return input;
+}
+} // namespace
+
+TEST(Hash128Tests, givenSameInputWhenHashIsCalculatedThenSameValueIsReturned) {
+    auto input = generateInput(1000u, 0u);
+    EXPECT_EQ(Hash128::hash(input.data(), input.size()), Hash128::hash(input.data(), input.size()));
+}
+
+TEST(Hash128Tests, givenNullptrOrEmptyInputWhenUpdatingThenStateIsNotChanged) {
+    Hash128 hash;
+    auto emptyHash = hash.finish();
+
+    hash.update(nullptr, 16u);
+    EXPECT_EQ(emptyHash, hash.finish());
+
+    hash.update("abc", 0u);
+    EXPECT_EQ(emptyHash, hash.finish());
+
+    hash.update("abc", 3u);
+    EXPECT_NE(emptyHash, hash.finish());
+
+    hash.reset();
+    EXPECT_EQ(emptyHash, hash.finish());
+}
+
+TEST(Hash128Tests, givenInputSplitIntoChunksWhenHashIsCalculatedThenResultIsSameAsForSingleUpdate) {
+    for (size_t size : {0u, 1u, 7u, 8u, 31u, 32u, 33u, 100u, 4096u, 65537u}) {
+        auto input = generateInput(size, static_cast<uint32_t>(size));
+        auto expected = Hash128::hash(input.data(), input.size());
+
+        for (size_t chunkSize : {1u, 3u, 8u, 31u, 32u, 1000u}) {
+            Hash128 hash;
+            for (size_t offset = 0; offset < size; offset += chunkSize) {
+                hash.update(input.data() + offset, std::min(chunkSize, size - offset));
+            }
+            EXPECT_EQ(expected, hash.finish()) << "size: " << size << ", chunk size: " << chunkSize;
+        }
+    }
+}
+
+TEST(Hash128Tests, givenMisalignedBufferWhenHashIsCalculatedThenResultIsSameAsForAlignedBuffer) {
+    auto input = generateInput(1024u, 1u);
+    std::vector<char> misalignedStorage(input.size() + 1);
+    std::copy(input.begin(), input.end(), misalignedStorage.begin() + 1);
+
+    EXPECT_EQ(Hash128::hash(input.data(), input.size()), Hash128::hash(misalignedStorage.data() + 1, input.size()));
+}
+
+TEST(Hash128Tests, givenInputsDifferingInSingleBitWhenHashIsCalculatedThenBothHalvesDiffer) {
+    for (size_t size : {1u, 16u, 32u, 100u, 4096u}) {
+        auto input = generateInput(size, 2u);
+        auto original = Hash128::hash(input.data(), input.size());
+        for (size_t bit = 0; bit < 8; bit++) {
+            auto modified = input;
+            modified[size / 2] ^= static_cast<char>(1u << bit);
+            auto modifiedHash = Hash128::hash(modified.data(), modified.size());
+            EXPECT_NE(original.low, modifiedHash.low);
+            EXPECT_NE(original.high, modifiedHash.high);
+        }
+    }
+}
+
+TEST(Hash128Tests, givenZeroFilledInputsOfDifferentLengthsWhenHashIsCalculatedThenValuesAreUnique) {
+    std::vector<char> zeros(256u, 0);
+    std::set<std::pair<uint64_t, uint64_t>> hashes;
+    for (size_t size = 0; size <= zeros.size(); size++) {
+        auto value = Hash128::hash(zeros.data(), size);
+        EXPECT_TRUE(hashes.emplace(value.low, value.high).second) << size;
+    }
+}
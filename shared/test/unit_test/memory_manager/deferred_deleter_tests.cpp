@@ -1,14 +1,17 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/memory_manager/deferrable_deletion.h"
 #include "shared/test/common/mocks/mock_deferred_deleter.h"
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 using namespace NEO;
 
 TEST(DeferredDeleter, WhenDeferredDeleterIsCreatedThenItIsNotMoveableOrCopyable) {
@@ -34,3 +37,103 @@ TEST(DeferredDeleter, givenDeferredDeleterWhenNonBlockingDrainIsCalledThenArElem
     EXPECT_EQ(0, deleter->areElementsReleasedCalled);
     EXPECT_EQ(1, deleter->drainCalled);
 }
+
+struct SizedDeferrableDeletion : public DeferrableDeletion {
+    SizedDeferrableDeletion(size_t size, bool externalHandle, std::vector<size_t> &appliedDeletions)
+        : size(size), externalHandle(externalHandle), appliedDeletions(appliedDeletions) {}
+
+    bool apply() override {
+        if (!ready) {
+            return false;
+        }
+        appliedDeletions.push_back(size);
+        return true;
+    }
+    size_t getSize() const override { return size; }
+    bool isExternalHandle() const override { return externalHandle; }
+
+    size_t size;
+    bool externalHandle;
+    bool ready = true;
+    std::vector<size_t> &appliedDeletions;
+};
+
+TEST(DeferredDeleter, givenDeletionsOfDifferentKindsWhenDeferringThenEachIsQueuedInItsPriorityClass) {
+    std::vector<size_t> appliedDeletions;
+    auto deleter = std::make_unique<MockDeferredDeleter>();
+
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(MemoryConstants::pageSize, false, appliedDeletions));
+    EXPECT_FALSE(deleter->queue.peekIsEmpty());
+    EXPECT_TRUE(deleter->largeAllocationsQueue.peekIsEmpty());
+    EXPECT_TRUE(deleter->externalHandlesQueue.peekIsEmpty());
+
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(DeferredDeleter::largeAllocationThreshold, false, appliedDeletions));
+    EXPECT_FALSE(deleter->largeAllocationsQueue.peekIsEmpty());
+
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(DeferredDeleter::largeAllocationThreshold, true, appliedDeletions));
+    EXPECT_FALSE(deleter->externalHandlesQueue.peekIsEmpty());
+    EXPECT_EQ(3, deleter->getElementsToRelease());
+
+    deleter->clearQueue();
+    EXPECT_EQ(3u, appliedDeletions.size());
+    EXPECT_EQ(0, deleter->getElementsToRelease());
+}
+
+TEST(DeferredDeleter, givenQueuedDeletionsWhenClearingQueueThenLargestAllocationsAreReleasedFirstAndTinyObjectsLast) {
+    std::vector<size_t> appliedDeletions;
+    auto deleter = std::make_unique<MockDeferredDeleter>();
+
+    auto tiny = new SizedDeferrableDeletion(MemoryConstants::pageSize, false, appliedDeletions);
+    auto large = new SizedDeferrableDeletion(2 * MemoryConstants::megaByte, false, appliedDeletions);
+    auto external = new SizedDeferrableDeletion(3 * MemoryConstants::pageSize, true, appliedDeletions);
+    auto largest = new SizedDeferrableDeletion(8 * MemoryConstants::megaByte, false, appliedDeletions);
+    std::vector<size_t> expectedOrder = {largest->size, large->size, external->size, tiny->size};
+    for (auto deletion : {tiny, large, external, largest}) {
+        deleter->DeferredDeleter::deferDeletion(deletion);
+    }
+    deleter->clearQueue();
+    EXPECT_EQ(expectedOrder, appliedDeletions);
+}
+
+TEST(DeferredDeleter, givenQueuedDeletionsWhenReleasingBytesThenOnlyLargestDeletionsCoveringRequestedSizeAreApplied) {
+    std::vector<size_t> appliedDeletions;
+    auto deleter = std::make_unique<MockDeferredDeleter>();
+
+    auto tiny = new SizedDeferrableDeletion(MemoryConstants::pageSize, false, appliedDeletions);
+    auto large = new SizedDeferrableDeletion(4 * MemoryConstants::megaByte, false, appliedDeletions);
+    auto largest = new SizedDeferrableDeletion(8 * MemoryConstants::megaByte, false, appliedDeletions);
+    for (auto deletion : {tiny, large, largest}) {
+        deleter->DeferredDeleter::deferDeletion(deletion);
+    }
+
+    EXPECT_EQ(8 * MemoryConstants::megaByte, deleter->releaseBytes(5 * MemoryConstants::megaByte));
+    ASSERT_EQ(1u, appliedDeletions.size());
+    EXPECT_EQ(8 * MemoryConstants::megaByte, appliedDeletions[0]);
+    EXPECT_EQ(2, deleter->getElementsToRelease());
+
+    EXPECT_EQ(4 * MemoryConstants::megaByte + MemoryConstants::pageSize, deleter->releaseBytes(16 * MemoryConstants::megaByte));
+    EXPECT_EQ(3u, appliedDeletions.size());
+    EXPECT_EQ(0, deleter->getElementsToRelease());
+    EXPECT_EQ(0u, deleter->releaseBytes(MemoryConstants::pageSize));
+}
+
+TEST(DeferredDeleter, givenNotReadyDeletionWhenReleasingBytesThenItIsSkippedAndStaysQueued) {
+    std::vector<size_t> appliedDeletions;
+    auto deleter = std::make_unique<MockDeferredDeleter>();
+
+    auto busyLargest = new SizedDeferrableDeletion(8 * MemoryConstants::megaByte, false, appliedDeletions);
+    busyLargest->ready = false;
+    auto large = new SizedDeferrableDeletion(4 * MemoryConstants::megaByte, false, appliedDeletions);
+    deleter->DeferredDeleter::deferDeletion(busyLargest);
+    deleter->DeferredDeleter::deferDeletion(large);
+
+    EXPECT_EQ(4 * MemoryConstants::megaByte, deleter->releaseBytes(MemoryConstants::megaByte));
+    ASSERT_EQ(1u, appliedDeletions.size());
+    EXPECT_EQ(4 * MemoryConstants::megaByte, appliedDeletions[0]);
+    EXPECT_FALSE(deleter->largeAllocationsQueue.peekIsEmpty());
+    EXPECT_EQ(1, deleter->getElementsToRelease());
+
+    busyLargest->ready = true;
+    deleter->clearQueue();
+    EXPECT_EQ(0, deleter->getElementsToRelease());
+}
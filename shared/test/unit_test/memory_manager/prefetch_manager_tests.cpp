@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -86,3 +86,65 @@ TEST(PrefetchManagerTests, givenPrefetchManagerWhenCallingMigrateAllocationsToGp
     EXPECT_TRUE(prefetchManager->migrateAllocationsToGpuCalled);
     EXPECT_FALSE(svmManager->prefetchMemoryCalled);
 }
+
+TEST(PrefetchManagerTests, givenDebugFlagWhenCheckingIfPredictivePrefetchIsEnabledThenDisabledByDefault) {
+    DebugManagerStateRestore restore;
+    EXPECT_FALSE(PrefetchManager::isPredictivePrefetchEnabled());
+
+    debugManager.flags.EnablePredictiveUsmPrefetch.set(0);
+    EXPECT_FALSE(PrefetchManager::isPredictivePrefetchEnabled());
+
+    debugManager.flags.EnablePredictiveUsmPrefetch.set(1);
+    EXPECT_TRUE(PrefetchManager::isPredictivePrefetchEnabled());
+}
+
+TEST(PrefetchManagerTests, givenKernelAllocationsWhenInsertingThenOnlySharedUnifiedMemoryIsAddedOnceAndCountersAreUpdatedOnMigration) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+
+    SVMAllocsManager::UnifiedMemoryProperties sharedProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto sharedPtr = svmManager->createSharedUnifiedMemoryAllocation(4096u, sharedProperties, nullptr);
+    ASSERT_NE(nullptr, sharedPtr);
+
+    SVMAllocsManager::UnifiedMemoryProperties deviceProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    deviceProperties.device = device;
+    auto devicePtr = svmManager->createUnifiedMemoryAllocation(4096u, deviceProperties);
+    ASSERT_NE(nullptr, devicePtr);
+
+    auto sharedAllocation = svmManager->getSVMAlloc(sharedPtr)->gpuAllocations.getGraphicsAllocation(mockRootDeviceIndex);
+    auto deviceAllocation = svmManager->getSVMAlloc(devicePtr)->gpuAllocations.getGraphicsAllocation(mockRootDeviceIndex);
+    std::vector<GraphicsAllocation *> kernelAllocations = {nullptr, deviceAllocation, sharedAllocation, sharedAllocation};
+
+    EXPECT_TRUE(prefetchManager->insertKernelAllocations(prefetchContext, *svmManager, kernelAllocations));
+    ASSERT_EQ(1u, prefetchContext.allocations.size());
+    EXPECT_EQ(sharedPtr, prefetchContext.allocations[0]);
+    EXPECT_EQ(1u, prefetchManager->getPredictedAllocationsCount());
+
+    EXPECT_FALSE(prefetchManager->insertKernelAllocations(prefetchContext, *svmManager, kernelAllocations));
+    EXPECT_EQ(1u, prefetchContext.allocations.size());
+    EXPECT_EQ(1u, prefetchManager->getPredictedAllocationsCount());
+
+    EXPECT_EQ(0u, prefetchManager->getPrefetchedAllocationsCount());
+    EXPECT_EQ(0u, prefetchManager->getPrefetchedBytes());
+
+    prefetchManager->migrateAllocationsToGpu(prefetchContext, *svmManager, *device, *csr);
+    EXPECT_EQ(1u, prefetchManager->getPrefetchedAllocationsCount());
+    EXPECT_EQ(4096u, prefetchManager->getPrefetchedBytes());
+
+    prefetchManager->removeAllocations(prefetchContext);
+    EXPECT_TRUE(prefetchContext.allocationsLookup.empty());
+
+    prefetchManager->insertAllocation(prefetchContext, sharedPtr, *svmManager->getSVMAlloc(sharedPtr));
+    EXPECT_FALSE(prefetchManager->insertKernelAllocations(prefetchContext, *svmManager, kernelAllocations));
+    EXPECT_EQ(1u, prefetchContext.allocations.size());
+    EXPECT_EQ(1u, prefetchManager->getPredictedAllocationsCount());
+
+    svmManager->freeSVMAlloc(sharedPtr);
+    svmManager->freeSVMAlloc(devicePtr);
+}
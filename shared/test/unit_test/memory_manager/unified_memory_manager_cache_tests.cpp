@@ -141,24 +141,17 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDevic
         ASSERT_NE(testData.allocation, nullptr);
     }
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), ++expectedCacheSize);
-        bool foundInCache = false;
-        for (auto i = 0u; i < svmManager->usmDeviceAllocationsCache.allocations.size(); ++i) {
-            if (svmManager->usmDeviceAllocationsCache.allocations[i].allocation == testData.allocation) {
-                foundInCache = true;
-                break;
-            }
-        }
-        EXPECT_TRUE(foundInCache);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), ++expectedCacheSize);
+        EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(testData.allocation));
     }
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocatingAfterFreeThenReturnCorrectCachedAllocation) {
@@ -190,26 +183,26 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAlloc
     }
 
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
     std::vector<void *> allocationsToFree;
 
     for (auto &testData : testDataset) {
         auto secondAllocation = svmManager->createUnifiedMemoryAllocation(testData.allocationSize, unifiedMemoryProperties);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size() - 1);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size() - 1);
         EXPECT_EQ(secondAllocation, testData.allocation);
         svmManager->freeSVMAlloc(secondAllocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
     }
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFreeThenReturnAllocationsInCacheStartingFromSmallest) {
@@ -237,29 +230,29 @@ TEST_F(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfter
         ASSERT_NE(testData.allocation, nullptr);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
     size_t expectedCacheSize = testDataset.size();
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto allocationLargerThanInCache = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis << 3, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto firstAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(firstAllocation, testDataset[0].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto secondAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(secondAllocation, testDataset[1].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -267,7 +260,7 @@ TEST_F(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfter
     svmManager->freeSVMAlloc(allocationLargerThanInCache);
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 struct SvmDeviceAllocationCacheTestDataType {
@@ -337,12 +330,12 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAlloc
         for (auto &testData : testDataset) {
             testData.allocation = svmManager->createUnifiedMemoryAllocation(testData.allocationSize, testData.unifiedMemoryProperties);
         }
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
         for (auto &testData : testDataset) {
             svmManager->freeSVMAlloc(testData.allocation);
         }
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
         auto allocationFromCache = svmManager->createUnifiedMemoryAllocation(allocationDataToVerify.allocationSize, allocationDataToVerify.unifiedMemoryProperties);
         EXPECT_EQ(allocationFromCache, allocationDataToVerify.allocation);
@@ -355,7 +348,7 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAlloc
         svmManager->freeSVMAlloc(allocationNotFromCache);
 
         svmManager->trimUSMDeviceAllocCache();
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     }
 }
 
@@ -379,22 +372,22 @@ TEST_F(SvmDeviceAllocationCacheTest, givenDeviceOutOfMemoryWhenAllocatingThenCac
     auto allocationInCache = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache3 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(allocationInCache);
     svmManager->freeSVMAlloc(allocationInCache2);
     svmManager->freeSVMAllocDefer(allocationInCache3);
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 3u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 3u);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache2), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache3), nullptr);
     auto ptr = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
     EXPECT_NE(ptr, nullptr);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(ptr);
 
     svmManager->trimUSMDeviceAllocCache();
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 using SvmHostAllocationCacheTest = Test<SvmAllocationCacheTestFixture>;
@@ -411,17 +404,17 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheDefaultWhenCheckingIfEnab
     SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
     auto allocation = svmManager->createHostUnifiedMemoryAllocation(1u, unifiedMemoryProperties);
     EXPECT_NE(nullptr, allocation);
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.getNumAllocations());
 
     EXPECT_TRUE(svmManager->freeSVMAlloc(allocation));
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.getNumAllocations());
 
     allocation = svmManager->createHostUnifiedMemoryAllocation(1u, unifiedMemoryProperties);
     EXPECT_NE(nullptr, allocation);
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.getNumAllocations());
 
     EXPECT_TRUE(svmManager->freeSVMAllocDefer(allocation));
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.getNumAllocations());
 }
 
 struct SvmHostAllocationCacheSimpleTestDataType {
@@ -455,24 +448,17 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDeviceA
         ASSERT_NE(testData.allocation, nullptr);
     }
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), ++expectedCacheSize);
-        bool foundInCache = false;
-        for (auto i = 0u; i < svmManager->usmHostAllocationsCache.allocations.size(); ++i) {
-            if (svmManager->usmHostAllocationsCache.allocations[i].allocation == testData.allocation) {
-                foundInCache = true;
-                break;
-            }
-        }
-        EXPECT_TRUE(foundInCache);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), ++expectedCacheSize);
+        EXPECT_TRUE(svmManager->usmHostAllocationsCache.isInCache(testData.allocation));
     }
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), testDataset.size());
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), testDataset.size());
 
     svmManager->trimUSMHostAllocCache();
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocatingAfterFreeThenReturnCorrectCachedAllocation) {
@@ -503,26 +489,26 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocat
     }
 
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), testDataset.size());
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), testDataset.size());
 
     std::vector<void *> allocationsToFree;
 
     for (auto &testData : testDataset) {
         auto secondAllocation = svmManager->createHostUnifiedMemoryAllocation(testData.allocationSize, unifiedMemoryProperties);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), testDataset.size() - 1);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), testDataset.size() - 1);
         EXPECT_EQ(secondAllocation, testData.allocation);
         svmManager->freeSVMAlloc(secondAllocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), testDataset.size());
+        EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), testDataset.size());
     }
 
     svmManager->trimUSMHostAllocCache();
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST_F(SvmHostAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFreeThenReturnAllocationsInCacheStartingFromSmallest) {
@@ -549,29 +535,29 @@ TEST_F(SvmHostAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
         ASSERT_NE(testData.allocation, nullptr);
     }
 
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
     size_t expectedCacheSize = testDataset.size();
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto allocationLargerThanInCache = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis << 3, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto firstAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(firstAllocation, testDataset[0].allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto secondAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(secondAllocation, testDataset[1].allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -579,7 +565,7 @@ TEST_F(SvmHostAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
     svmManager->freeSVMAlloc(allocationLargerThanInCache);
 
     svmManager->trimUSMHostAllocCache();
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 }
 
 struct SvmHostAllocationCacheTestDataType {
@@ -641,12 +627,12 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         for (auto &testData : testDataset) {
             testData.allocation = svmManager->createHostUnifiedMemoryAllocation(testData.allocationSize, testData.unifiedMemoryProperties);
         }
-        ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
 
         for (auto &testData : testDataset) {
             svmManager->freeSVMAlloc(testData.allocation);
         }
-        ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), testDataset.size());
+        ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), testDataset.size());
 
         auto allocationFromCache = svmManager->createHostUnifiedMemoryAllocation(allocationDataToVerify.allocationSize, allocationDataToVerify.unifiedMemoryProperties);
         EXPECT_EQ(allocationFromCache, allocationDataToVerify.allocation);
@@ -659,7 +645,7 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         svmManager->freeSVMAlloc(allocationNotFromCache);
 
         svmManager->trimUSMHostAllocCache();
-        ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
     }
 }
 
@@ -682,20 +668,220 @@ TEST_F(SvmHostAllocationCacheTest, givenHostOutOfMemoryWhenAllocatingThenCacheIs
     auto allocationInCache = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache2 = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache3 = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(allocationInCache);
     svmManager->freeSVMAlloc(allocationInCache2);
     svmManager->freeSVMAllocDefer(allocationInCache3);
 
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 3u);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 3u);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache2), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache3), nullptr);
     auto ptr = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
     EXPECT_NE(ptr, nullptr);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(ptr);
 
     svmManager->trimUSMHostAllocCache();
-    ASSERT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
-}
\ No newline at end of file
+    ASSERT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
+}
+TEST(SvmAllocationCacheBucketsTest, givenSizesWhenGettingBucketIndexThenSizeClassesArePowersOfTwoSplitIntoSubBuckets) {
+    using SvmAllocationCache = SVMAllocsManager::SvmAllocationCache;
+    constexpr auto allocationSizeBasis = MemoryConstants::pageSize64k;
+    constexpr auto subBucketSize = allocationSizeBasis / SvmAllocationCache::subBucketsCount;
+
+    EXPECT_EQ(0u, SvmAllocationCache::getBucketIndex(0u));
+    EXPECT_EQ(1u, SvmAllocationCache::getBucketIndex(1u));
+    EXPECT_EQ(SvmAllocationCache::getBucketIndex(allocationSizeBasis), SvmAllocationCache::getBucketIndex(allocationSizeBasis + subBucketSize - 1));
+    EXPECT_EQ(SvmAllocationCache::getBucketIndex(allocationSizeBasis) + 1, SvmAllocationCache::getBucketIndex(allocationSizeBasis + subBucketSize));
+    EXPECT_EQ(SvmAllocationCache::getBucketIndex(allocationSizeBasis) + SvmAllocationCache::subBucketsCount - 1, SvmAllocationCache::getBucketIndex((allocationSizeBasis << 1) - 1));
+    EXPECT_EQ(SvmAllocationCache::getBucketIndex(allocationSizeBasis) + SvmAllocationCache::subBucketsCount, SvmAllocationCache::getBucketIndex(allocationSizeBasis << 1));
+    EXPECT_EQ(SvmAllocationCache::bucketsCount - 1, SvmAllocationCache::getBucketIndex(std::numeric_limits<size_t>::max()));
+
+    for (size_t size = 1u; size < 4 * MemoryConstants::megaByte; size += MemoryConstants::pageSize) {
+        EXPECT_LE(SvmAllocationCache::getBucketIndex(size - 1), SvmAllocationCache::getBucketIndex(size));
+    }
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenAllocatingAndFreeingThenHitsMissesAndHeldBytesAreTracked) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, allocation);
+    ASSERT_NE(nullptr, allocation2);
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getHits());
+    EXPECT_EQ(2u, svmManager->usmDeviceAllocationsCache.getMisses());
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getHeldBytes());
+
+    svmManager->freeSVMAlloc(allocation);
+    svmManager->freeSVMAlloc(allocation2);
+    EXPECT_EQ(MemoryConstants::pageSize64k * 3, svmManager->usmDeviceAllocationsCache.getHeldBytes());
+
+    auto allocationFromCache = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_EQ(allocation, allocationFromCache);
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getHits());
+    EXPECT_EQ(2u, svmManager->usmDeviceAllocationsCache.getMisses());
+    EXPECT_EQ(MemoryConstants::pageSize64k * 2, svmManager->usmDeviceAllocationsCache.getHeldBytes());
+
+    svmManager->freeSVMAlloc(allocationFromCache);
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getHeldBytes());
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getHits());
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheByteBudgetWhenFreeingAllocationsThenLeastRecentlyFreedAllocationsAreReleased) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    debugManager.flags.ExperimentalUsmAllocationsCacheMaxBytes.set(MemoryConstants::pageSize64k * 2);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+    EXPECT_EQ(MemoryConstants::pageSize64k * 2, svmManager->usmDeviceAllocationsCache.maxHeldBytes);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation3 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocationAboveBudget = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 3, unifiedMemoryProperties);
+
+    svmManager->freeSVMAlloc(allocationAboveBudget);
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(allocationAboveBudget));
+
+    svmManager->freeSVMAlloc(allocation);
+    svmManager->freeSVMAlloc(allocation2);
+    EXPECT_EQ(2u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+
+    svmManager->freeSVMAlloc(allocation3);
+    EXPECT_EQ(2u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+    EXPECT_EQ(MemoryConstants::pageSize64k * 2, svmManager->usmDeviceAllocationsCache.getHeldBytes());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(allocation));
+    EXPECT_FALSE(svmManager->usmDeviceAllocationsCache.isInCache(allocation));
+    EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(allocation2));
+    EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(allocation3));
+
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheMaxAgeWhenTrimmingOldAllocationsThenOnlyAllocationsOlderThanMaxAgeAreReleased) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    debugManager.flags.ExperimentalUsmAllocationsCacheMaxAge.set(100000);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+    EXPECT_EQ(std::chrono::milliseconds(100000), svmManager->usmDeviceAllocationsCache.maxAge);
+    EXPECT_NE(nullptr, svmManager->unifiedMemoryReuseCleaner);
+    EXPECT_EQ(device->getExecutionEnvironment()->unifiedMemoryReuseCleaner.get(), svmManager->unifiedMemoryReuseCleaner);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(allocation);
+    const auto firstFreeTime = std::chrono::steady_clock::now();
+    svmManager->freeSVMAlloc(allocation2);
+    EXPECT_EQ(2u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+
+    svmManager->usmDeviceAllocationsCache.trimOldAllocs(firstFreeTime);
+    EXPECT_EQ(2u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+
+    {
+        std::lock_guard<std::mutex> lock(svmManager->usmDeviceAllocationsCache.mtx);
+        auto &bucket = svmManager->usmDeviceAllocationsCache.buckets[SVMAllocsManager::SvmAllocationCache::getBucketIndex(MemoryConstants::pageSize64k * 2)];
+        ASSERT_EQ(1u, bucket.size());
+        bucket[0]->saveTime = firstFreeTime + std::chrono::milliseconds(100000);
+    }
+    svmManager->usmDeviceAllocationsCache.trimOldAllocs(firstFreeTime + std::chrono::milliseconds(100001));
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(allocation));
+    EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(allocation2));
+
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheByteBudgetAndOldestAllocationInUseWhenFreeingAllocationThenAllocationInUseIsKeptInCache) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    debugManager.flags.ExperimentalUsmAllocationsCacheMaxBytes.set(MemoryConstants::pageSize64k);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(allocation));
+
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getMemoryManager());
+    memoryManager->deferAllocInUse = true;
+    svmManager->freeSVMAlloc(allocation2);
+    memoryManager->deferAllocInUse = false;
+
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+    EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(allocation));
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(allocation));
+    EXPECT_FALSE(svmManager->usmDeviceAllocationsCache.isInCache(allocation2));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(allocation2));
+
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheMaxAgeAndOldAllocationInUseWhenTrimmingOldAllocationsThenAllocationInUseIsKeptInCache) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    debugManager.flags.ExperimentalUsmAllocationsCacheMaxAge.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(allocation);
+    const auto trimTimePoint = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getMemoryManager());
+    memoryManager->deferAllocInUse = true;
+    svmManager->usmDeviceAllocationsCache.trimOldAllocs(trimTimePoint);
+    EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(allocation));
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(allocation));
+
+    memoryManager->deferAllocInUse = false;
+    svmManager->usmDeviceAllocationsCache.trimOldAllocs(trimTimePoint);
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(allocation));
+}
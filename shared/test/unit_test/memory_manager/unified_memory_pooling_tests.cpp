@@ -223,3 +223,163 @@ TEST_F(InitializationFailedUnifiedMemoryPoolingTest, givenNotInitializedPoolWhen
     EXPECT_EQ(0u, usmMemAllocPool.getPooledAllocationSize(bogusPtr));
     EXPECT_EQ(nullptr, usmMemAllocPool.getPooledAllocationBasePtr(bogusPtr));
 }
+
+TEST(UsmMemAllocPoolsManagerTest, givenAllocationSizesWhenGettingPoolTierThenTinySmallAndMediumTiersAreReturned) {
+    EXPECT_EQ(UsmMemAllocPoolsManager::PoolTier::tiny, UsmMemAllocPoolsManager::getPoolTier(1u));
+    EXPECT_EQ(UsmMemAllocPoolsManager::PoolTier::tiny, UsmMemAllocPoolsManager::getPoolTier(UsmMemAllocPoolsManager::tinyAllocationThreshold - 1));
+    EXPECT_EQ(UsmMemAllocPoolsManager::PoolTier::small, UsmMemAllocPoolsManager::getPoolTier(UsmMemAllocPoolsManager::tinyAllocationThreshold));
+    EXPECT_EQ(UsmMemAllocPoolsManager::PoolTier::small, UsmMemAllocPoolsManager::getPoolTier(UsmMemAllocPoolsManager::smallAllocationThreshold - 1));
+    EXPECT_EQ(UsmMemAllocPoolsManager::PoolTier::medium, UsmMemAllocPoolsManager::getPoolTier(UsmMemAllocPoolsManager::smallAllocationThreshold));
+    EXPECT_EQ(UsmMemAllocPoolsManager::PoolTier::medium, UsmMemAllocPoolsManager::getPoolTier(UsmMemAllocPool::allocationThreshold));
+}
+
+TEST(UsmMemAllocPoolsManagerTest, givenDebugFlagWhenCheckingIfPoolsManagerIsEnabledThenDisabledByDefault) {
+    DebugManagerStateRestore restorer;
+    EXPECT_FALSE(UsmMemAllocPoolsManager::isEnabled());
+
+    debugManager.flags.EnableUsmAllocationPoolsManager.set(0);
+    EXPECT_FALSE(UsmMemAllocPoolsManager::isEnabled());
+
+    debugManager.flags.EnableUsmAllocationPoolsManager.set(1);
+    EXPECT_TRUE(UsmMemAllocPoolsManager::isEnabled());
+}
+
+class UsmMemAllocPoolsManagerHostTest : public UnifiedMemoryPoolingTest {
+  public:
+    void SetUp() override {
+        UnifiedMemoryPoolingTest::setUp();
+        deviceFactory = std::unique_ptr<UltDeviceFactory>(new UltDeviceFactory(1, 1));
+        svmManager = std::make_unique<MockSVMAllocsManager>(deviceFactory->rootDevices[0]->getMemoryManager(), false);
+        memoryProperties = std::make_unique<SVMAllocsManager::UnifiedMemoryProperties>(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize2M, rootDeviceIndices, deviceBitfields);
+        EXPECT_FALSE(poolsManager.isInitialized());
+        poolsManager.initialize(svmManager.get(), *memoryProperties, nullptr);
+        EXPECT_TRUE(poolsManager.isInitialized());
+        memoryProperties->alignment = UsmMemAllocPool::chunkAlignment;
+    }
+    void TearDown() override {
+        poolsManager.cleanup();
+        UnifiedMemoryPoolingTest::tearDown();
+    }
+
+    std::unique_ptr<UltDeviceFactory> deviceFactory;
+    std::unique_ptr<MockSVMAllocsManager> svmManager;
+    std::unique_ptr<SVMAllocsManager::UnifiedMemoryProperties> memoryProperties;
+    MockUsmMemAllocPoolsManager poolsManager;
+};
+
+TEST_F(UsmMemAllocPoolsManagerHostTest, givenPoolsOfTierExhaustedWhenAllocatingThenNewPoolIsAddedToThatTierOnly) {
+    const auto tinySize = 2 * MemoryConstants::kiloByte;
+    const auto allocationsToFillPool = UsmMemAllocPoolsManager::tierPoolSizes[static_cast<uint32_t>(UsmMemAllocPoolsManager::PoolTier::tiny)] / tinySize;
+
+    std::vector<void *> allocations;
+    void *allocationFromNewPool = nullptr;
+    for (auto i = 0u; i <= allocationsToFillPool && allocationFromNewPool == nullptr; ++i) {
+        auto allocation = poolsManager.createUnifiedMemoryAllocation(tinySize, *memoryProperties);
+        ASSERT_NE(nullptr, allocation);
+        allocations.push_back(allocation);
+        if (poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::tiny) > 1u) {
+            allocationFromNewPool = allocation;
+        }
+    }
+    ASSERT_NE(nullptr, allocationFromNewPool);
+    EXPECT_GE(allocations.size(), allocationsToFillPool);
+    EXPECT_EQ(2u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::tiny));
+    EXPECT_EQ(0u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::small));
+    EXPECT_EQ(0u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::medium));
+
+    auto mediumAllocation = poolsManager.createUnifiedMemoryAllocation(UsmMemAllocPool::allocationThreshold, *memoryProperties);
+    ASSERT_NE(nullptr, mediumAllocation);
+    allocations.push_back(mediumAllocation);
+    EXPECT_EQ(1u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::medium));
+    EXPECT_EQ(2 * UsmMemAllocPoolsManager::tierPoolSizes[0] + UsmMemAllocPoolsManager::tierPoolSizes[2], poolsManager.getTotalPoolsSize());
+
+    EXPECT_EQ(UsmMemAllocPool::allocationThreshold, poolsManager.getPooledAllocationSize(mediumAllocation));
+    EXPECT_EQ(mediumAllocation, poolsManager.getPooledAllocationBasePtr(ptrOffset(mediumAllocation, 1)));
+    EXPECT_EQ(tinySize, poolsManager.getPooledAllocationSize(allocationFromNewPool));
+
+    for (auto allocation : allocations) {
+        EXPECT_TRUE(poolsManager.freeSVMAlloc(allocation, true));
+    }
+    EXPECT_FALSE(poolsManager.freeSVMAlloc(mediumAllocation, true));
+    EXPECT_FALSE(poolsManager.freeSVMAlloc(reinterpret_cast<void *>(0x1), true));
+}
+
+TEST_F(UsmMemAllocPoolsManagerHostTest, givenNotPoolableAllocationWhenAllocatingThenNullptrIsReturnedAndNoPoolIsAdded) {
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(UsmMemAllocPool::allocationThreshold + 1, *memoryProperties));
+
+    auto otherProperties = *memoryProperties;
+    otherProperties.memoryType = InternalMemoryType::deviceUnifiedMemory;
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(1u, otherProperties));
+
+    otherProperties = *memoryProperties;
+    otherProperties.device = deviceFactory->rootDevices[0];
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(1u, otherProperties));
+
+    otherProperties = *memoryProperties;
+    otherProperties.alignment = UsmMemAllocPool::chunkAlignment / 2;
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(1u, otherProperties));
+
+    otherProperties = *memoryProperties;
+    otherProperties.allocationFlags.allFlags = 1u;
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(1u, otherProperties));
+
+    EXPECT_EQ(0u, poolsManager.getTotalPoolsSize());
+}
+
+TEST_F(UsmMemAllocPoolsManagerHostTest, givenEmptyPoolWhenIdleTimeElapsedThenPoolIsReleased) {
+    const auto startTime = std::chrono::steady_clock::now();
+    poolsManager.cpuTimestamp = startTime;
+
+    auto tinyAllocation = poolsManager.createUnifiedMemoryAllocation(1u, *memoryProperties);
+    auto smallAllocation = poolsManager.createUnifiedMemoryAllocation(UsmMemAllocPoolsManager::tinyAllocationThreshold, *memoryProperties);
+    ASSERT_NE(nullptr, tinyAllocation);
+    ASSERT_NE(nullptr, smallAllocation);
+    EXPECT_EQ(1u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::tiny));
+    EXPECT_EQ(1u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::small));
+
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(tinyAllocation, true));
+    poolsManager.trimIdlePools(startTime + poolsManager.poolIdleTime);
+    EXPECT_EQ(1u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::tiny));
+
+    poolsManager.cpuTimestamp = startTime + poolsManager.poolIdleTime + std::chrono::milliseconds(1);
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(smallAllocation, true));
+    EXPECT_EQ(0u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::tiny));
+    EXPECT_EQ(1u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::small));
+
+    poolsManager.trimIdlePools(poolsManager.cpuTimestamp + poolsManager.poolIdleTime + std::chrono::milliseconds(1));
+    EXPECT_EQ(0u, poolsManager.getTotalPoolsSize());
+}
+
+TEST_F(UsmMemAllocPoolsManagerHostTest, givenIdlePoolUsedByGpuWhenAllocatingThenPoolIsReleasedWithDeferredFree) {
+    auto mockMemoryManager = static_cast<MockMemoryManager *>(deviceFactory->rootDevices[0]->getMemoryManager());
+    const auto startTime = std::chrono::steady_clock::now();
+    poolsManager.cpuTimestamp = startTime;
+
+    auto tinyAllocation = poolsManager.createUnifiedMemoryAllocation(1u, *memoryProperties);
+    ASSERT_NE(nullptr, tinyAllocation);
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(tinyAllocation, false));
+    EXPECT_EQ(1u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::tiny));
+
+    mockMemoryManager->deferAllocInUse = true;
+    poolsManager.cpuTimestamp = startTime + poolsManager.poolIdleTime + std::chrono::milliseconds(1);
+    auto smallAllocation = poolsManager.createUnifiedMemoryAllocation(UsmMemAllocPoolsManager::tinyAllocationThreshold, *memoryProperties);
+    ASSERT_NE(nullptr, smallAllocation);
+    EXPECT_EQ(0u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::tiny));
+    EXPECT_EQ(1u, poolsManager.getPoolsCount(UsmMemAllocPoolsManager::PoolTier::small));
+    EXPECT_EQ(1u, svmManager->svmDeferFreeAllocs.allocations.size());
+
+    mockMemoryManager->deferAllocInUse = false;
+    svmManager->freeSVMAllocDeferImpl();
+    EXPECT_EQ(0u, svmManager->svmDeferFreeAllocs.allocations.size());
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(smallAllocation, true));
+}
+
+TEST_F(UsmMemAllocPoolsManagerHostTest, givenIdleTimeDebugFlagWhenInitializingThenIdleTimeIsOverridden) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(UsmMemAllocPoolsManager::defaultPoolIdleTime, poolsManager.poolIdleTime);
+
+    debugManager.flags.UsmAllocationPoolsIdleTime.set(5);
+    MockUsmMemAllocPoolsManager otherPoolsManager;
+    otherPoolsManager.initialize(svmManager.get(), *memoryProperties, nullptr);
+    EXPECT_EQ(std::chrono::milliseconds(5), otherPoolsManager.poolIdleTime);
+}
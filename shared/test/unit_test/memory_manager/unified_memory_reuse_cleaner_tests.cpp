@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/unified_memory_reuse_cleaner.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/mocks/ult_device_factory.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <thread>
+
+namespace NEO {
+
+struct MockUnifiedMemoryReuseCleaner : public UnifiedMemoryReuseCleaner {
+    using UnifiedMemoryReuseCleaner::keepCleaning;
+    using UnifiedMemoryReuseCleaner::svmAllocationCaches;
+    using UnifiedMemoryReuseCleaner::trimOldInCaches;
+    using UnifiedMemoryReuseCleaner::unifiedMemoryReuseCleanerThread;
+
+    void sleep() override {
+        UnifiedMemoryReuseCleaner::sleep();
+        this->sleepCalled = true;
+    }
+
+    std::chrono::steady_clock::time_point getCpuTimestamp() override {
+        return cpuTimestamp;
+    }
+
+    std::chrono::steady_clock::time_point cpuTimestamp{};
+    std::atomic<bool> sleepCalled{false};
+};
+
+TEST(UnifiedMemoryReuseCleanerTests, givenUnifiedMemoryReuseCleanerWhenCreatedThenThreadIsStartedAndStoppedOnDestruction) {
+    auto cleaner = std::make_unique<MockUnifiedMemoryReuseCleaner>();
+    EXPECT_NE(nullptr, cleaner->unifiedMemoryReuseCleanerThread);
+    while (!cleaner->sleepCalled) {
+        std::this_thread::yield();
+    }
+    cleaner.reset();
+}
+
+TEST(UnifiedMemoryReuseCleanerTests, givenRegisteredCacheWhenTrimmingOldInCachesThenAllocationsOlderThanMaxAgeAreReleasedUntilCacheIsUnregistered) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    if (!device->getHardwareInfo().capabilityTable.ftrSvm) {
+        GTEST_SKIP();
+    }
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+    EXPECT_EQ(nullptr, svmManager->unifiedMemoryReuseCleaner);
+
+    MockUnifiedMemoryReuseCleaner cleaner;
+    cleaner.keepCleaning.store(false);
+    cleaner.unifiedMemoryReuseCleanerThread->join();
+    cleaner.unifiedMemoryReuseCleanerThread.reset();
+
+    svmManager->usmDeviceAllocationsCache.maxAge = std::chrono::milliseconds(1);
+    cleaner.registerSvmAllocationCache(&svmManager->usmDeviceAllocationsCache);
+    EXPECT_EQ(1u, cleaner.svmAllocationCaches.size());
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(allocation);
+    auto allocation2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
+    const auto freeTime = std::chrono::steady_clock::now();
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+
+    cleaner.cpuTimestamp = freeTime - std::chrono::seconds(1);
+    cleaner.trimOldInCaches();
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+
+    cleaner.cpuTimestamp = freeTime + std::chrono::seconds(1);
+    cleaner.trimOldInCaches();
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(allocation));
+
+    cleaner.unregisterSvmAllocationCache(&svmManager->usmDeviceAllocationsCache);
+    EXPECT_TRUE(cleaner.svmAllocationCaches.empty());
+
+    svmManager->freeSVMAlloc(allocation2);
+    cleaner.trimOldInCaches();
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.getNumAllocations());
+
+    svmManager->trimUSMDeviceAllocCache();
+}
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
 #include "shared/test/common/test_macros/test.h"
@@ -26,6 +27,7 @@
 #include <mutex>
 #include <sched.h>
 #include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -187,3 +189,107 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+struct MockBatchedDrmGemCloseWorker : DrmGemCloseWorker {
+    using DrmGemCloseWorker::batchingEnabled;
+    using DrmGemCloseWorker::batchSize;
+    using DrmGemCloseWorker::DrmGemCloseWorker;
+    using DrmGemCloseWorker::maxPendingBufferObjects;
+    using DrmGemCloseWorker::workCount;
+};
+
+TEST_F(DrmGemCloseWorkerTests, givenBatchingDebugFlagsWhenWorkerIsCreatedThenBatchingIsConfigured) {
+    this->drmMock->gemCloseExpected = 0;
+    DebugManagerStateRestore restorer;
+    EXPECT_FALSE(DrmGemCloseWorker::isBatchingEnabled());
+    {
+        MockBatchedDrmGemCloseWorker worker(*mm);
+        EXPECT_FALSE(worker.batchingEnabled);
+        EXPECT_EQ(DrmGemCloseWorker::defaultBatchSize, worker.batchSize);
+        EXPECT_EQ(DrmGemCloseWorker::defaultMaxPendingBufferObjects, worker.maxPendingBufferObjects);
+    }
+
+    debugManager.flags.EnableBatchedGemCloseWorker.set(1);
+    debugManager.flags.GemCloseWorkerBatchSize.set(8);
+    debugManager.flags.GemCloseWorkerMaxPendingBufferObjects.set(32);
+    MockBatchedDrmGemCloseWorker worker(*mm);
+    EXPECT_TRUE(worker.batchingEnabled);
+    EXPECT_EQ(8u, worker.batchSize);
+    EXPECT_EQ(32u, worker.maxPendingBufferObjects);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBatchedWorkerWhenBufferObjectsArePushedThenAllAreClosedBeforeWorkerIsDestroyed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedGemCloseWorker.set(1);
+    this->drmMock->gemCloseExpected = 100;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    for (auto i = 0; i < 100; i++) {
+        worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+    }
+
+    delete worker;
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBatchedWorkerWhenDrainIsRequestedThenPendingBufferObjectsAreClosedWithoutBlockingCaller) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedGemCloseWorker.set(1);
+    debugManager.flags.GemCloseWorkerBatchSize.set(1000);
+    this->drmMock->gemCloseExpected = 3;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    for (auto i = 0; i < 3; i++) {
+        worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+    }
+    worker->drainAsync();
+
+    while (!worker->isEmpty() && (deadCnt-- > 0))
+        sched_yield();
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(3, this->drmMock->gemCloseCnt.load());
+    EXPECT_NE(drmMock->ioctlCallerThreadId, std::this_thread::get_id());
+
+    delete worker;
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBatchedWorkerWithTooManyPendingBufferObjectsWhenPushingThenBufferObjectIsClosedInCallingThread) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedGemCloseWorker.set(1);
+    debugManager.flags.GemCloseWorkerMaxPendingBufferObjects.set(4);
+    this->drmMock->gemCloseExpected = 1;
+
+    auto worker = new MockBatchedDrmGemCloseWorker(*mm);
+    worker->workCount = 4;
+    worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+
+    EXPECT_EQ(1, this->drmMock->gemCloseCnt.load());
+    EXPECT_EQ(drmMock->ioctlCallerThreadId, std::this_thread::get_id());
+    EXPECT_EQ(4u, worker->workCount.load());
+
+    worker->workCount = 0;
+    delete worker;
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBatchedWorkerWhenBufferObjectsArePushedFromMultipleThreadsThenEachIsClosedOnce) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedGemCloseWorker.set(1);
+    constexpr int threadsCount = 8;
+    constexpr int bufferObjectsPerThread = 250;
+    this->drmMock->gemCloseExpected = threadsCount * bufferObjectsPerThread;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < threadsCount; i++) {
+        threads.emplace_back([&]() {
+            for (auto j = 0; j < bufferObjectsPerThread; j++) {
+                worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    delete worker;
+}
@@ -15,6 +15,7 @@
 #include "shared/test/common/libult/linux/drm_query_mock.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/mocks/mock_os_library.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "gtest/gtest.h"
@@ -967,3 +968,107 @@ TEST(MemoryInfo, givenMemoryInfoWithRegionsWhenCallingCreatingGemExtWithMultiple
     EXPECT_EQ(3u, createExt->memoryRegions[2].memoryInstance);
     EXPECT_EQ(size, drm->context.receivedCreateGemExt->size);
 }
+
+TEST(MemoryInfoPrelim, givenGpuLocalHostAllocationPlacementEnabledWhenQueryingMemoryInfoThenNumaNodeOfDeviceIsUsedForHostAllocations) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    executionEnvironment->rootDeviceEnvironments[0]->initGmm();
+
+    auto drm = std::make_unique<DrmQueryMock>(*executionEnvironment->rootDeviceEnvironments[0]);
+    drm->setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        const std::string testData("1\n");
+        memcpy(buf, testData.data(), testData.length() + 1);
+        return 3;
+    });
+
+    drm->queryMemoryInfo();
+    ASSERT_NE(nullptr, drm->getMemoryInfo());
+    EXPECT_EQ(-1, drm->getMemoryInfo()->getHostAllocationNumaNode());
+
+    debugManager.flags.EnableGpuLocalHostAllocationPlacement.set(1);
+    drm->queryMemoryInfo();
+    ASSERT_NE(nullptr, drm->getMemoryInfo());
+    EXPECT_EQ(1, drm->getMemoryInfo()->getHostAllocationNumaNode());
+
+    debugManager.flags.OverrideHostAllocationNumaNode.set(3);
+    drm->queryMemoryInfo();
+    ASSERT_NE(nullptr, drm->getMemoryInfo());
+    EXPECT_EQ(3, drm->getMemoryInfo()->getHostAllocationNumaNode());
+}
+
+struct MemoryInfoWithMemPolicy : public MemoryInfo {
+    using MemoryInfo::MemoryInfo;
+    using MemoryInfo::memPolicySupported;
+};
+
+TEST(MemoryInfoPrelim, givenHostAllocationNumaNodeAndMemPolicyNotSupportedWhenCreatingSystemMemoryGemObjectThenPolicyIsNotPassed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.OverrideHostAllocationMemPolicyMode.set(-1);
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[0].probedSize = 8 * MemoryConstants::gigaByte;
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    regionInfo[1].probedSize = 16 * MemoryConstants::gigaByte;
+
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = std::make_unique<DrmQueryMock>(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto memoryInfo = std::make_unique<MemoryInfoWithMemPolicy>(regionInfo, *drm);
+    memoryInfo->memPolicySupported = false;
+    memoryInfo->setHostAllocationNumaNode(1);
+
+    uint32_t handle = 0;
+    uint32_t numOfChunks = 0;
+    MemRegionsVec systemRegion = {regionInfo[0].region};
+    auto ret = memoryInfo->createGemExt(systemRegion, 1024, handle, 0, {}, -1, false, numOfChunks, true);
+    EXPECT_EQ(0, ret);
+    ASSERT_TRUE(drm->context.receivedCreateGemExt);
+    EXPECT_EQ(std::nullopt, drm->context.receivedCreateGemExt->memPolicyExt.mode);
+    EXPECT_EQ(std::nullopt, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask);
+}
+
+TEST(MemoryInfoPrelim, givenHostAllocationNumaNodeWhenCreatingSystemMemoryGemObjectThenPreferredPolicyWithDeviceNodeIsPassed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.OverrideHostAllocationMemPolicyMode.set(-1);
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[0].probedSize = 8 * MemoryConstants::gigaByte;
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    regionInfo[1].probedSize = 16 * MemoryConstants::gigaByte;
+
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = std::make_unique<DrmQueryMock>(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto memoryInfo = std::make_unique<MemoryInfoWithMemPolicy>(regionInfo, *drm);
+    memoryInfo->memPolicySupported = true;
+    memoryInfo->setHostAllocationNumaNode(65);
+
+    uint32_t handle = 0;
+    uint32_t numOfChunks = 0;
+    MemRegionsVec systemRegion = {regionInfo[0].region};
+    auto ret = memoryInfo->createGemExt(systemRegion, 1024, handle, 0, {}, -1, false, numOfChunks, false);
+    EXPECT_EQ(0, ret);
+    ASSERT_TRUE(drm->context.receivedCreateGemExt);
+    EXPECT_EQ(1u, drm->context.receivedCreateGemExt->memPolicyExt.mode);
+    ASSERT_EQ(2u, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value().size());
+    EXPECT_EQ(0u, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value()[0]);
+    EXPECT_EQ(2u, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value()[1]);
+
+    MemRegionsVec sharedRegions = {regionInfo[0].region, regionInfo[1].region};
+    ret = memoryInfo->createGemExt(sharedRegions, 1024, handle, 0, {}, -1, false, numOfChunks, false);
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(std::nullopt, drm->context.receivedCreateGemExt->memPolicyExt.mode);
+    EXPECT_EQ(std::nullopt, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask);
+
+    debugManager.flags.OverrideHostAllocationMemPolicyMode.set(2);
+    memoryInfo = std::make_unique<MemoryInfoWithMemPolicy>(regionInfo, *drm);
+    memoryInfo->memPolicySupported = true;
+    memoryInfo->setHostAllocationNumaNode(0);
+    ret = memoryInfo->createGemExt(sharedRegions, 1024, handle, 0, {}, -1, false, numOfChunks, true);
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(2u, drm->context.receivedCreateGemExt->memPolicyExt.mode);
+    ASSERT_EQ(1u, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value().size());
+    EXPECT_EQ(1u, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value()[0]);
+}
@@ -34,13 +34,17 @@
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture_prelim.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include <chrono>
+#include <future>
 #include <memory>
+#include <thread>
 
 using namespace NEO;
 
 struct MockDrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandlerBind {
     using DrmMemoryOperationsHandlerBind::DrmMemoryOperationsHandlerBind;
     using DrmMemoryOperationsHandlerBind::evictImpl;
+    using DrmMemoryOperationsHandlerBind::residencyShardMutexes;
 
     bool useBaseEvictUnused = true;
     uint32_t evictUnusedCalled = 0;
@@ -585,6 +589,220 @@ TEST_F(DrmMemoryOperationsHandlerBindTest,
     delete allocation;
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenBatchedVmBindDebugFlagWhenCheckingIfEnabledThenDisabledByDefault) {
+    EXPECT_FALSE(DrmMemoryOperationsHandlerBind::isBatchedBindEnabled());
+
+    debugManager.flags.EnableBatchedVmBind.set(0);
+    EXPECT_FALSE(DrmMemoryOperationsHandlerBind::isBatchedBindEnabled());
+
+    debugManager.flags.EnableBatchedVmBind.set(1);
+    EXPECT_TRUE(DrmMemoryOperationsHandlerBind::isBatchedBindEnabled());
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenBatchedVmBindWhenMakeResidentWithinOsContextThenEachBoIsBoundOnceAndSingleUserFenceIsSignaledPerVm) {
+    mock->isVMBindImmediateSupported = true;
+    auto osContext = device->getDefaultEngine().osContext;
+    auto deviceBitfield = osContext->getDeviceBitfield();
+
+    constexpr size_t numAllocations = 8u;
+    for (auto batchedBind : {0, 1}) {
+        debugManager.flags.EnableBatchedVmBind.set(batchedBind);
+
+        std::vector<GraphicsAllocation *> allocations;
+        for (auto i = 0u; i < numAllocations; i++) {
+            allocations.push_back(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize}));
+            ASSERT_NE(nullptr, allocations.back());
+        }
+
+        auto fenceValues = mock->fenceVal;
+        mock->context.vmBindCalled = 0u;
+        EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(allocations), false));
+
+        EXPECT_EQ(numAllocations * deviceBitfield.count(), mock->context.vmBindCalled);
+        auto lastVmHandleId = 0u;
+        for (auto vmHandleId = 0u; vmHandleId < deviceBitfield.size(); vmHandleId++) {
+            if (!deviceBitfield.test(vmHandleId)) {
+                continue;
+            }
+            auto expectedFenceSignals = batchedBind ? 1u : numAllocations;
+            EXPECT_EQ(fenceValues[vmHandleId] + expectedFenceSignals, mock->fenceVal[vmHandleId]);
+            lastVmHandleId = vmHandleId;
+        }
+        ASSERT_TRUE(mock->context.receivedVmBindUserFence);
+        EXPECT_EQ(mock->fenceVal[lastVmHandleId], mock->context.receivedVmBindUserFence->val);
+
+        for (auto allocation : allocations) {
+            EXPECT_TRUE(allocation->isAlwaysResident(osContext->getContextId()));
+        }
+
+        mock->context.vmBindCalled = 0u;
+        EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(allocations), false));
+        EXPECT_EQ(0u, mock->context.vmBindCalled);
+
+        for (auto allocation : allocations) {
+            memoryManager->freeGraphicsMemory(allocation);
+        }
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenBatchedVmBindAndBindFailureWhenMakeResidentWithinOsContextThenErrorIsReturnedAndAllocationIsNotMarkedAsAlwaysResident) {
+    debugManager.flags.EnableBatchedVmBind.set(1);
+    operationHandler->useBaseEvictUnused = false;
+    auto osContext = device->getDefaultEngine().osContext;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, allocation);
+
+    mock->context.vmBindReturn = -1;
+    EXPECT_EQ(MemoryOperationsStatus::outOfMemory, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), false));
+    EXPECT_EQ(1u, operationHandler->evictUnusedCalled);
+    EXPECT_FALSE(allocation->isAlwaysResident(osContext->getContextId()));
+
+    mock->context.vmBindReturn = 0;
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenBatchedVmBindAndFailureOfThirdBindWhenMakeResidentWithinOsContextThenPreviousBindsOfBatchAreRolledBack) {
+    debugManager.flags.EnableBatchedVmBind.set(1);
+    mock->isVMBindImmediateSupported = true;
+    operationHandler->useBaseEvictUnused = false;
+    auto osContext = device->getDefaultEngine().osContext;
+    auto deviceBitfield = osContext->getDeviceBitfield();
+
+    constexpr size_t numAllocations = 4u;
+    std::vector<GraphicsAllocation *> allocations;
+    for (auto i = 0u; i < numAllocations; i++) {
+        allocations.push_back(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize}));
+        ASSERT_NE(nullptr, allocations.back());
+    }
+
+    mock->context.vmBindCalled = 0u;
+    mock->context.vmUnbindCalled = 0u;
+    mock->context.vmBindFailingFromCall = 3u;
+    EXPECT_EQ(MemoryOperationsStatus::outOfMemory, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(allocations), false));
+    EXPECT_EQ(1u, operationHandler->evictUnusedCalled);
+    EXPECT_EQ(4u, mock->context.vmBindCalled);
+    EXPECT_EQ(2u, mock->context.vmUnbindCalled);
+    for (auto allocation : allocations) {
+        EXPECT_FALSE(allocation->isAlwaysResident(osContext->getContextId()));
+    }
+
+    mock->context.vmBindFailingFromCall.reset();
+    mock->context.vmBindCalled = 0u;
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(allocations), false));
+    EXPECT_EQ(numAllocations * deviceBitfield.count(), mock->context.vmBindCalled);
+
+    for (auto allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenResidencyShardLockingDisabledWhenGettingResidencyShardIndexThenFirstShardIsUsed) {
+    for (auto &engine : device->getAllEngines()) {
+        for (auto vmHandleId = 0u; vmHandleId < EngineLimits::maxHandleCount; vmHandleId++) {
+            EXPECT_EQ(0u, operationHandler->getResidencyShardIndex(engine.osContext, vmHandleId));
+        }
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenSharedVmsWhenGettingResidencyShardIndexThenItDependsOnlyOnVmHandle) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableResidencyShardLocking.set(1);
+
+    for (auto &engine : device->getAllEngines()) {
+        for (auto vmHandleId = 0u; vmHandleId < EngineLimits::maxHandleCount; vmHandleId++) {
+            EXPECT_EQ(vmHandleId, operationHandler->getResidencyShardIndex(engine.osContext, vmHandleId));
+        }
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenResidencyShardLockingAndBoundEvictableAllocationsWhenMakeResidentWithinOsContextThenResidencyShardIsNotLocked) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableResidencyShardLocking.set(1);
+
+    auto osContext = device->getDefaultEngine().osContext;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), true));
+    auto vmBindCalled = mock->context.vmBindCalled;
+
+    std::vector<std::unique_lock<std::mutex>> shardLocks;
+    for (auto &shardMutex : operationHandler->residencyShardMutexes) {
+        shardLocks.emplace_back(shardMutex);
+    }
+    auto result = std::async(std::launch::async, [&]() {
+        return operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), true);
+    });
+    auto status = result.wait_for(std::chrono::seconds(10));
+    shardLocks.clear();
+
+    EXPECT_EQ(std::future_status::ready, status);
+    EXPECT_EQ(MemoryOperationsStatus::success, result.get());
+    EXPECT_EQ(vmBindCalled, mock->context.vmBindCalled);
+    EXPECT_FALSE(allocation->isAlwaysResident(osContext->getContextId()));
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenResidencyShardLockingAndBoundAllocationsWhenMakeResidentWithinOsContextNotEvictableThenAllocationsAreMarkedAlwaysResidentUnderShardLock) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableResidencyShardLocking.set(1);
+
+    auto osContext = device->getDefaultEngine().osContext;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), true));
+
+    std::unique_lock<std::mutex> shardLock(operationHandler->residencyShardMutexes[operationHandler->getResidencyShardIndex(osContext, 0u)]);
+    auto result = std::async(std::launch::async, [&]() {
+        return operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), false);
+    });
+    EXPECT_EQ(std::future_status::timeout, result.wait_for(std::chrono::milliseconds(50)));
+    EXPECT_FALSE(allocation->isAlwaysResident(osContext->getContextId()));
+    shardLock.unlock();
+
+    EXPECT_EQ(MemoryOperationsStatus::success, result.get());
+    EXPECT_TRUE(allocation->isAlwaysResident(osContext->getContextId()));
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenBoundAllocationsWhenMakingThemResidentConcurrentlyFromManyEnginesThenAllSucceedWithoutBinding) {
+    constexpr size_t numAllocations = 64u;
+    std::vector<GraphicsAllocation *> allocations;
+    for (auto i = 0u; i < numAllocations; i++) {
+        allocations.push_back(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize}));
+        ASSERT_NE(nullptr, allocations.back());
+    }
+    auto &engines = device->getAllEngines();
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResidentWithinOsContext(device->getDefaultEngine().osContext, ArrayRef<GraphicsAllocation *>(allocations), true));
+    auto vmBindCalled = mock->context.vmBindCalled;
+
+    std::atomic<uint32_t> failures{0u};
+    std::vector<std::thread> threads;
+    for (auto &engine : engines) {
+        threads.emplace_back([&, osContext = engine.osContext]() {
+            for (auto iteration = 0u; iteration < 100u; iteration++) {
+                if (operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(allocations), iteration % 2 == 0) != MemoryOperationsStatus::success) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, failures);
+    EXPECT_EQ(vmBindCalled, mock->context.vmBindCalled);
+    for (auto allocation : allocations) {
+        for (auto &engine : engines) {
+            EXPECT_TRUE(allocation->isAlwaysResident(engine.osContext->getContextId()));
+        }
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, givenDrmMemoryOperationBindWhenMakeResidentWithinOsContextEvictableAllocationThenAllocationIsNotMarkedAsAlwaysResident) {
     auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
 
@@ -819,6 +1037,21 @@ struct DrmMemoryOperationsHandlerBindWithPerContextVms : public DrmMemoryOperati
     }
 };
 
+TEST_F(DrmMemoryOperationsHandlerBindWithPerContextVms, givenPerContextVmsWhenGettingResidencyShardIndexThenItDependsOnOsContextAndVmHandle) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableResidencyShardLocking.set(1);
+
+    auto &engines = device->getAllEngines();
+    ASSERT_LE(2u, engines.size());
+    auto firstContext = engines[0].osContext;
+    auto secondContext = engines[1].osContext;
+
+    EXPECT_NE(operationHandler->getResidencyShardIndex(firstContext, 0u), operationHandler->getResidencyShardIndex(firstContext, 1u));
+    EXPECT_NE(operationHandler->getResidencyShardIndex(firstContext, 0u), operationHandler->getResidencyShardIndex(secondContext, 0u));
+    EXPECT_EQ((secondContext->getContextId() * EngineLimits::maxHandleCount + 1u) % DrmMemoryOperationsHandlerBind::residencyShardsCount,
+              operationHandler->getResidencyShardIndex(secondContext, 1u));
+}
+
 HWTEST_F(DrmMemoryOperationsHandlerBindWithPerContextVms, givenVmBindMultipleSubdevicesAndPErContextVmsWhenValidateHostptrThenCorrectContextsVmIdIsUsed) {
     mock->bindAvailable = true;
     mock->incrementVmId = true;
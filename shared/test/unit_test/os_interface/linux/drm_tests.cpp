@@ -169,6 +169,49 @@ TEST(DrmTest, GivenInValidSysfsNodeWhenGetDeviceMemoryMaxClockRateInMhzIsCalledT
     EXPECT_FALSE(drm.getDeviceMemoryMaxClockRateInMhz(0, clkRate));
 }
 
+TEST(DrmTest, GivenValidNumaNodeSysfsEntryWhenGetDeviceNumaNodeIsCalledThenNodeIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        const std::string testData("1\n");
+        memcpy(buf, testData.data(), testData.length() + 1);
+        return 3;
+    });
+    int numaNode = -1;
+    EXPECT_TRUE(drm.getDeviceNumaNode(numaNode));
+    EXPECT_EQ(1, numaNode);
+}
+
+TEST(DrmTest, GivenNumaNodeNotReportedBySysfsWhenGetDeviceNumaNodeIsCalledThenReturnFalse) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        const std::string testData("-1\n");
+        memcpy(buf, testData.data(), testData.length() + 1);
+        return 4;
+    });
+    int numaNode = 5;
+    EXPECT_FALSE(drm.getDeviceNumaNode(numaNode));
+    EXPECT_EQ(5, numaNode);
+
+    mockOpen = [](const char *pathname, int flags) -> int {
+        return -1;
+    };
+    EXPECT_FALSE(drm.getDeviceNumaNode(numaNode));
+}
+
 TEST(DrmTest, GivenPciPathCouldNotBeRetrievedWhenGetDeviceMemoryPhysicalSizeInBytesIsCalledThenReturnZero) {
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
     DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
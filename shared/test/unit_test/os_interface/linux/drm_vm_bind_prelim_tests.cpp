@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -213,3 +213,43 @@ TEST(DrmVmBindTest, givenDrmWithPageFaultSupportWhenCallingBindBoOnUnifiedShared
         EXPECT_EQ(DrmPrelimHelper::getImmediateVmBindFlag() | DrmPrelimHelper::getMakeResidentVmBindFlag(), drm.context.receivedVmBind->flags);
     }
 }
+
+TEST(DrmVmBindTest, givenBatchOfBosWhenBindingBufferObjectsThenUnboundBosAreBoundAndOnlyLastBindRequiringUserFenceSignalsIt) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    executionEnvironment->rootDeviceEnvironments[0]->initGmm();
+    executionEnvironment->initializeMemoryManager();
+    DrmQueryMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    drm.pageFaultSupported = true;
+    drm.isVMBindImmediateSupported = true;
+
+    OsContextLinux osContext(drm, 0, 0u, EngineDescriptorHelper::getDefaultDescriptor());
+    osContext.ensureContextInitialized();
+    uint32_t vmHandleId = 0;
+
+    MockBufferObject alreadyBoundBo(0, &drm, 3, 1, 0, 1);
+    MockBufferObject bo0(0, &drm, 3, 2, 0, 1);
+    MockBufferObject bo1(0, &drm, 3, 3, 0, 1);
+    MockBufferObject bo2(0, &drm, 3, 4, 0, 1);
+    MockBufferObject bo3(0, &drm, 3, 5, 0, 1);
+    alreadyBoundBo.requireExplicitResidency(true);
+    alreadyBoundBo.bindInfo[0][vmHandleId] = true;
+    bo0.requireExplicitResidency(true);
+    bo1.requireExplicitResidency(false);
+    bo2.requireExplicitResidency(true);
+    bo3.requireExplicitResidency(false);
+
+    EXPECT_TRUE(drm.isUserFenceRequiredForBind(&bo0));
+    EXPECT_FALSE(drm.isUserFenceRequiredForBind(&bo1));
+
+    BufferObject *bos[] = {&bo0, &bo1, &bo2, &bo3, &alreadyBoundBo};
+    EXPECT_EQ(0, drm.bindBufferObjects(&osContext, vmHandleId, ArrayRef<BufferObject *>(bos)));
+
+    EXPECT_EQ(4u, drm.context.vmBindCalled);
+    EXPECT_EQ(1u, drm.fenceVal[vmHandleId]);
+    ASSERT_TRUE(drm.context.receivedVmBindUserFence);
+    EXPECT_EQ(castToUint64(drm.getFenceAddr(vmHandleId)), drm.context.receivedVmBindUserFence->addr);
+    EXPECT_EQ(1u, drm.context.receivedVmBindUserFence->val);
+    for (auto bo : bos) {
+        EXPECT_TRUE(bo->bindInfo[0][vmHandleId]);
+    }
+}
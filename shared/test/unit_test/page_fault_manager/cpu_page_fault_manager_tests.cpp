@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -868,3 +868,123 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
     EXPECT_EQ(allocs[3], unifiedMemoryManager->nonGpuDomainAllocs[3]);
 }
+
+TEST_F(PageFaultManagerTest, givenDebugFlagsWhenCheckingRangeMigrationThenDisabledByDefaultWith2MBRanges) {
+    DebugManagerStateRestore restore;
+    EXPECT_FALSE(PageFaultManager::isRangeMigrationEnabled());
+    EXPECT_EQ(MemoryConstants::pageSize2M, PageFaultManager::getMigrationRangeSize());
+
+    debugManager.flags.EnableRangeGranularUsmMigration.set(1);
+    EXPECT_TRUE(PageFaultManager::isRangeMigrationEnabled());
+
+    debugManager.flags.UsmMigrationRangeSize.set(static_cast<int32_t>(MemoryConstants::pageSize + 1));
+    EXPECT_EQ(2 * MemoryConstants::pageSize, PageFaultManager::getMigrationRangeSize());
+}
+
+TEST_F(PageFaultManagerTest, givenRangeMigrationEnabledWhenInsertingAllocationsThenOnlyAllocationsLargerThanRangeAreTrackedInRanges) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableRangeGranularUsmMigration.set(1);
+    debugManager.flags.UsmMigrationRangeSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    void *smallAlloc = reinterpret_cast<void *>(0x10000);
+    void *largeAlloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(smallAlloc, MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_TRUE(pageFaultManager->memoryData[smallAlloc].rangeDomains.empty());
+
+    pageFaultManager->insertAllocation(largeAlloc, 4 * MemoryConstants::pageSize + 1, unifiedMemoryManager.get(), nullptr, {});
+    auto &pageFaultData = pageFaultManager->memoryData[largeAlloc];
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultData.rangeSize);
+    ASSERT_EQ(5u, pageFaultData.rangeDomains.size());
+    for (auto rangeDomain : pageFaultData.rangeDomains) {
+        EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, rangeDomain);
+    }
+}
+
+TEST_F(PageFaultManagerTest, givenRangeMigrationEnabledWhenCpuSparselyAccessesLargeAllocationThenOnlyTouchedRangesAreTransferred) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableRangeGranularUsmMigration.set(1);
+
+    constexpr size_t rangeSize = MemoryConstants::pageSize2M;
+    constexpr size_t allocSize = 32 * rangeSize + MemoryConstants::pageSize;
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x40000000);
+
+    pageFaultManager->insertAllocation(alloc, allocSize, unifiedMemoryManager.get(), cmdQ, {});
+    auto &pageFaultData = pageFaultManager->memoryData[alloc];
+    ASSERT_EQ(33u, pageFaultData.rangeDomains.size());
+
+    // allocation initialized on CPU is transferred with a single copy on first GPU use
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+    ASSERT_EQ(1, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(0u, pageFaultManager->transferredRangesToGpu[0].first);
+    EXPECT_EQ(allocSize, pageFaultManager->transferredRangesToGpu[0].second);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::gpu, pageFaultData.domain);
+    EXPECT_TRUE(unifiedMemoryManager->nonGpuDomainAllocs.empty());
+
+    // CPU reads header, a field in the middle and the tail of the allocation
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 16)));
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 10 * rangeSize + 5)));
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, allocSize - 1)));
+
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+    ASSERT_EQ(3, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(std::make_pair(size_t{0u}, rangeSize), pageFaultManager->transferredRangesToCpu[0]);
+    EXPECT_EQ(std::make_pair(10 * rangeSize, rangeSize), pageFaultManager->transferredRangesToCpu[1]);
+    EXPECT_EQ(std::make_pair(32 * rangeSize, MemoryConstants::pageSize), pageFaultManager->transferredRangesToCpu[2]);
+    EXPECT_EQ(ptrOffset(alloc, 32 * rangeSize), pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultData.domain);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::gpu, pageFaultData.rangeDomains[1]);
+    ASSERT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+    EXPECT_EQ(alloc, unifiedMemoryManager->nonGpuDomainAllocs[0]);
+
+    size_t bytesTransferredToCpu = 0u;
+    for (auto &range : pageFaultManager->transferredRangesToCpu) {
+        bytesTransferredToCpu += range.second;
+    }
+    EXPECT_EQ(2 * rangeSize + MemoryConstants::pageSize, bytesTransferredToCpu);
+
+    // only ranges touched by CPU are transferred back and protected again
+    pageFaultManager->transferredRangesToGpu.clear();
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    ASSERT_EQ(3u, pageFaultManager->transferredRangesToGpu.size());
+    EXPECT_EQ(std::make_pair(size_t{0u}, rangeSize), pageFaultManager->transferredRangesToGpu[0]);
+    EXPECT_EQ(std::make_pair(10 * rangeSize, rangeSize), pageFaultManager->transferredRangesToGpu[1]);
+    EXPECT_EQ(std::make_pair(32 * rangeSize, MemoryConstants::pageSize), pageFaultManager->transferredRangesToGpu[2]);
+    EXPECT_EQ(ptrOffset(alloc, 32 * rangeSize), pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::gpu, pageFaultData.domain);
+    for (auto rangeDomain : pageFaultData.rangeDomains) {
+        EXPECT_EQ(PageFaultManager::AllocationDomain::gpu, rangeDomain);
+    }
+    EXPECT_TRUE(unifiedMemoryManager->nonGpuDomainAllocs.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenRangeMigrationEnabledWhenRangeNeverMigratedToGpuIsAccessedThenItIsUnprotectedWithoutTransfer) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableRangeGranularUsmMigration.set(1);
+    debugManager.flags.UsmMigrationRangeSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    void *alloc = reinterpret_cast<void *>(0x100000);
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, 4 * MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, memoryProperties);
+    auto &pageFaultData = pageFaultManager->memoryData[alloc];
+    EXPECT_EQ(PageFaultManager::AllocationDomain::none, pageFaultData.domain);
+    EXPECT_EQ(1, pageFaultManager->protectMemoryCalled);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, MemoryConstants::pageSize)));
+    EXPECT_EQ(0, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(ptrOffset(alloc, MemoryConstants::pageSize), pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultData.domain);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::none, pageFaultData.rangeDomains[0]);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultData.rangeDomains[1]);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(4 * MemoryConstants::pageSize, pageFaultManager->accessAllowedSize);
+    EXPECT_TRUE(unifiedMemoryManager->nonGpuDomainAllocs.empty());
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/program/isa_pool_allocator.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/mocks/mock_device.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+using namespace NEO;
+
+struct MockISAPoolAllocator : public ISAPoolAllocator {
+    using ISAPoolAllocator::bufferPools;
+    using ISAPoolAllocator::builtinPools;
+    using ISAPoolAllocator::ISAPoolAllocator;
+};
+
+struct IsaPoolAllocatorTest : public ::testing::Test {
+    void SetUp() override {
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+        isaPoolAllocator = std::make_unique<MockISAPoolAllocator>(device.get());
+    }
+
+    void TearDown() override {
+        isaPoolAllocator->releasePools();
+    }
+
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockISAPoolAllocator> isaPoolAllocator;
+};
+
+TEST_F(IsaPoolAllocatorTest, givenDebugFlagWhenCheckingIfPoolingIsEnabledThenDisabledByDefault) {
+    DebugManagerStateRestore restorer;
+    EXPECT_FALSE(ISAPoolAllocator::isPoolingEnabled());
+
+    debugManager.flags.EnableIsaPooling.set(0);
+    EXPECT_FALSE(ISAPoolAllocator::isPoolingEnabled());
+
+    debugManager.flags.EnableIsaPooling.set(1);
+    EXPECT_TRUE(ISAPoolAllocator::isPoolingEnabled());
+}
+
+TEST_F(IsaPoolAllocatorTest, givenSmallIsaRequestsWhenAllocatingThenChunksOfSinglePoolAllocationAreReturned) {
+    auto first = isaPoolAllocator->requestGraphicsAllocationForIsa(false, 0x100);
+    auto second = isaPoolAllocator->requestGraphicsAllocationForIsa(false, 0x80);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+
+    EXPECT_EQ(1u, isaPoolAllocator->bufferPools.size());
+    EXPECT_TRUE(isaPoolAllocator->builtinPools.empty());
+    EXPECT_EQ(first->getGraphicsAllocation(), second->getGraphicsAllocation());
+    EXPECT_EQ(AllocationType::kernelIsa, first->getGraphicsAllocation()->getAllocationType());
+    EXPECT_NE(first->getOffset(), second->getOffset());
+    EXPECT_EQ(0u, first->getOffset() % MemoryConstants::cacheLineSize);
+    EXPECT_EQ(0u, second->getOffset() % MemoryConstants::cacheLineSize);
+    EXPECT_EQ(0x100u, first->getSize());
+    EXPECT_EQ(0x80u, second->getSize());
+
+    isaPoolAllocator->freeSharedIsaAllocation(first);
+    isaPoolAllocator->freeSharedIsaAllocation(second);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenBuiltinIsaRequestWhenAllocatingThenSeparateInternalPoolIsUsed) {
+    auto userIsa = isaPoolAllocator->requestGraphicsAllocationForIsa(false, 0x100);
+    auto builtinIsa = isaPoolAllocator->requestGraphicsAllocationForIsa(true, 0x100);
+    ASSERT_NE(nullptr, userIsa);
+    ASSERT_NE(nullptr, builtinIsa);
+
+    EXPECT_EQ(1u, isaPoolAllocator->bufferPools.size());
+    EXPECT_EQ(1u, isaPoolAllocator->builtinPools.size());
+    EXPECT_NE(userIsa->getGraphicsAllocation(), builtinIsa->getGraphicsAllocation());
+    EXPECT_EQ(AllocationType::kernelIsaInternal, builtinIsa->getGraphicsAllocation()->getAllocationType());
+
+    isaPoolAllocator->freeSharedIsaAllocation(userIsa);
+    isaPoolAllocator->freeSharedIsaAllocation(builtinIsa);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenIsaAboveThresholdWhenAllocatingThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, isaPoolAllocator->requestGraphicsAllocationForIsa(false, MemoryConstants::pageSize64k + 1));
+    EXPECT_TRUE(isaPoolAllocator->bufferPools.empty());
+}
+
+TEST_F(IsaPoolAllocatorTest, givenFreedIsaWhenPoolIsDrainedThenChunkIsReused) {
+    auto first = isaPoolAllocator->requestGraphicsAllocationForIsa(false, MemoryConstants::pageSize64k);
+    ASSERT_NE(nullptr, first);
+    auto firstOffset = first->getOffset();
+    isaPoolAllocator->freeSharedIsaAllocation(first);
+
+    std::vector<SharedIsaAllocation *> allocations;
+    for (size_t i = 0; i < 2 * MemoryConstants::megaByte / MemoryConstants::pageSize64k; i++) {
+        auto allocation = isaPoolAllocator->requestGraphicsAllocationForIsa(false, MemoryConstants::pageSize64k);
+        ASSERT_NE(nullptr, allocation);
+        allocations.push_back(allocation);
+    }
+    EXPECT_EQ(1u, isaPoolAllocator->bufferPools.size());
+    bool freedChunkReused = false;
+    for (auto allocation : allocations) {
+        freedChunkReused |= (allocation->getOffset() == firstOffset);
+        isaPoolAllocator->freeSharedIsaAllocation(allocation);
+    }
+    EXPECT_TRUE(freedChunkReused);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenRegisteredIsaWhenAcquiringWithSameHashThenSameAllocationIsReturnedUntilLastReferenceIsFreed) {
+    Hash128Value contentHash{0x1234u, 0x5678u};
+    const char content[] = "isa";
+    EXPECT_EQ(nullptr, isaPoolAllocator->acquireDeduplicatedIsa(contentHash, content, false));
+
+    auto isa = isaPoolAllocator->requestGraphicsAllocationForIsa(false, 0x100);
+    ASSERT_NE(nullptr, isa);
+    isaPoolAllocator->registerDeduplicatedIsa(contentHash, content, isa);
+    EXPECT_EQ(1u, isaPoolAllocator->getDeduplicatedIsaCount());
+
+    EXPECT_EQ(nullptr, isaPoolAllocator->acquireDeduplicatedIsa(contentHash, content, true));
+    EXPECT_EQ(nullptr, isaPoolAllocator->acquireDeduplicatedIsa(Hash128Value{0x1234u, 0x0u}, content, false));
+    EXPECT_EQ(isa, isaPoolAllocator->acquireDeduplicatedIsa(contentHash, content, false));
+
+    isaPoolAllocator->freeSharedIsaAllocation(isa);
+    EXPECT_EQ(1u, isaPoolAllocator->getDeduplicatedIsaCount());
+    EXPECT_EQ(isa, isaPoolAllocator->acquireDeduplicatedIsa(contentHash, content, false));
+
+    isaPoolAllocator->freeSharedIsaAllocation(isa);
+    isaPoolAllocator->freeSharedIsaAllocation(isa);
+    EXPECT_EQ(0u, isaPoolAllocator->getDeduplicatedIsaCount());
+    EXPECT_EQ(nullptr, isaPoolAllocator->acquireDeduplicatedIsa(contentHash, content, false));
+}
+
+TEST_F(IsaPoolAllocatorTest, givenIsaWithAlreadyRegisteredContentWhenRegisteringThenFirstRegistrationIsKept) {
+    Hash128Value contentHash{0x1234u, 0x5678u};
+    const char content[] = "isa";
+    auto first = isaPoolAllocator->requestGraphicsAllocationForIsa(false, 0x100);
+    auto second = isaPoolAllocator->requestGraphicsAllocationForIsa(false, 0x100);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+
+    isaPoolAllocator->registerDeduplicatedIsa(contentHash, content, first);
+    isaPoolAllocator->registerDeduplicatedIsa(contentHash, content, second);
+    EXPECT_EQ(1u, isaPoolAllocator->getDeduplicatedIsaCount());
+
+    isaPoolAllocator->freeSharedIsaAllocation(second);
+    EXPECT_EQ(1u, isaPoolAllocator->getDeduplicatedIsaCount());
+
+    auto acquired = isaPoolAllocator->acquireDeduplicatedIsa(contentHash, content, false);
+    EXPECT_EQ(first, acquired);
+    isaPoolAllocator->freeSharedIsaAllocation(acquired);
+    isaPoolAllocator->freeSharedIsaAllocation(first);
+    EXPECT_EQ(0u, isaPoolAllocator->getDeduplicatedIsaCount());
+}
+
+TEST_F(IsaPoolAllocatorTest, givenRegisteredIsaWhenAcquiringWithSameHashButDifferentContentThenNullptrIsReturned) {
+    Hash128Value contentHash{0x1234u, 0x5678u};
+    const char content[] = "isa";
+    const char collidingContent[] = "xyz";
+    const char longerContent[] = "isa_longer";
+
+    auto isa = isaPoolAllocator->requestGraphicsAllocationForIsa(false, 0x100);
+    ASSERT_NE(nullptr, isa);
+    isaPoolAllocator->registerDeduplicatedIsa(contentHash, content, isa);
+    EXPECT_EQ(1u, isaPoolAllocator->getDeduplicatedIsaCount());
+
+    EXPECT_EQ(nullptr, isaPoolAllocator->acquireDeduplicatedIsa(contentHash, collidingContent, false));
+    EXPECT_EQ(nullptr, isaPoolAllocator->acquireDeduplicatedIsa(contentHash, longerContent, false));
+    EXPECT_EQ(nullptr, isaPoolAllocator->acquireDeduplicatedIsa(contentHash, ArrayRef<const char>(), false));
+
+    auto colliding = isaPoolAllocator->requestGraphicsAllocationForIsa(false, 0x100);
+    ASSERT_NE(nullptr, colliding);
+    EXPECT_NE(isa, colliding);
+    isaPoolAllocator->registerDeduplicatedIsa(contentHash, collidingContent, colliding);
+    EXPECT_EQ(1u, isaPoolAllocator->getDeduplicatedIsaCount());
+    EXPECT_EQ(nullptr, isaPoolAllocator->acquireDeduplicatedIsa(contentHash, collidingContent, false));
+
+    EXPECT_EQ(isa, isaPoolAllocator->acquireDeduplicatedIsa(contentHash, content, false));
+    isaPoolAllocator->freeSharedIsaAllocation(isa);
+    isaPoolAllocator->freeSharedIsaAllocation(colliding);
+    isaPoolAllocator->freeSharedIsaAllocation(isa);
+    EXPECT_EQ(0u, isaPoolAllocator->getDeduplicatedIsaCount());
+}
+
+TEST_F(IsaPoolAllocatorTest, givenDeviceWhenGettingIsaPoolAllocatorThenAllocatorIsAvailable) {
+    auto isa = device->getIsaPoolAllocator().requestGraphicsAllocationForIsa(false, 0x100);
+    ASSERT_NE(nullptr, isa);
+    device->getIsaPoolAllocator().freeSharedIsaAllocation(isa);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,10 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
 void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
 }
+void PageFaultManager::transferRangeToCpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+}
+void PageFaultManager::transferRangeToGpu(void *ptr, size_t offset, size_t size, void *cmdQ) {
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
 }
 CompilerCacheConfig getDefaultCompilerCacheConfig() { return {}; }
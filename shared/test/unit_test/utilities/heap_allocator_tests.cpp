@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/utilities/heap_allocator.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "gtest/gtest.h"
@@ -1474,3 +1475,98 @@ TEST(HeapAllocatorTest, givenZeroAlignmentPassedWhenAllocatingMemoryWithCustomAl
     uint64_t ptr = heapAllocator.allocateWithCustomAlignment(ptrSize, 0u);
     EXPECT_EQ(alignUp(heapBase, allocationAlignment), ptr);
 }
+
+TEST(HeapAllocatorTest, givenDefaultModeWhenHeapAllocatorIsCreatedThenTwoSidedModeIsUsed) {
+    HeapAllocatorUnderTest heapAllocator(0x100000llu, 1024 * 4096);
+    EXPECT_EQ(HeapAllocatorMode::twoSided, heapAllocator.getMode());
+}
+
+TEST(HeapAllocatorTest, givenForceHeapAllocatorModeWhenHeapAllocatorIsCreatedThenForcedModeIsUsed) {
+    DebugManagerStateRestore restorer;
+
+    debugManager.flags.ForceHeapAllocatorMode.set(static_cast<int32_t>(HeapAllocatorMode::sizeClassBinned));
+    HeapAllocator binnedAllocator(0x100000llu, 1024 * 4096, allocationAlignment, sizeThreshold);
+    EXPECT_EQ(HeapAllocatorMode::sizeClassBinned, binnedAllocator.getMode());
+
+    debugManager.flags.ForceHeapAllocatorMode.set(static_cast<int32_t>(HeapAllocatorMode::twoSided));
+    HeapAllocator twoSidedAllocator(0x100000llu, 1024 * 4096, allocationAlignment, sizeThreshold, HeapAllocatorMode::sizeClassBinned);
+    EXPECT_EQ(HeapAllocatorMode::twoSided, twoSidedAllocator.getMode());
+}
+
+TEST(HeapAllocatorTest, givenBinnedModeWhenAllocatingAndFreeingThenUsageStatisticsAreUpdated) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1024 * 4096;
+    HeapAllocator heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold, HeapAllocatorMode::sizeClassBinned);
+
+    size_t ptrSize = 1;
+    auto ptr = heapAllocator.allocate(ptrSize);
+    EXPECT_EQ(heapBase, ptr);
+    EXPECT_EQ(allocationAlignment, ptrSize);
+    EXPECT_EQ(allocationAlignment, heapAllocator.getUsedSize());
+
+    heapAllocator.free(ptr, ptrSize);
+    EXPECT_EQ(0u, heapAllocator.getUsedSize());
+    EXPECT_EQ(heapSize, heapAllocator.getLeftSize());
+}
+
+TEST(HeapAllocatorTest, givenBinnedModeWhenAllocatingWithCustomAlignmentThenAlignedPointerIsReturned) {
+    const uint64_t heapBase = 0x111000llu;
+    const size_t heapSize = 1024 * 4096;
+    HeapAllocator heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold, HeapAllocatorMode::sizeClassBinned);
+
+    const size_t customAlignment = 32 * MemoryConstants::pageSize;
+    size_t ptrSize = MemoryConstants::pageSize;
+    auto ptr = heapAllocator.allocateWithCustomAlignment(ptrSize, customAlignment);
+    EXPECT_NE(0llu, ptr);
+    EXPECT_TRUE(isAligned(ptr, customAlignment));
+    EXPECT_EQ(MemoryConstants::pageSize, heapAllocator.getUsedSize());
+
+    heapAllocator.free(ptr, ptrSize);
+    EXPECT_EQ(0u, heapAllocator.getUsedSize());
+}
+
+TEST(HeapAllocatorTest, givenBinnedModeWhenAllocatingWholeHeapOrLastFreeBlockThenAllocationSucceeds) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1000 * 4096;
+    HeapAllocator heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold, HeapAllocatorMode::sizeClassBinned);
+
+    size_t ptrSize = heapSize;
+    EXPECT_EQ(heapBase, heapAllocator.allocate(ptrSize));
+    EXPECT_EQ(0u, heapAllocator.getLeftSize());
+    heapAllocator.free(heapBase, heapSize);
+
+    ptrSize = 967 * 4096;
+    EXPECT_EQ(heapBase, heapAllocator.allocate(ptrSize));
+    ptrSize = heapAllocator.getLeftSize();
+    EXPECT_EQ(33u * 4096, ptrSize);
+    EXPECT_EQ(heapBase + 967 * 4096, heapAllocator.allocate(ptrSize));
+    EXPECT_EQ(0u, heapAllocator.getLeftSize());
+}
+
+TEST(HeapAllocatorTest, givenBinnedModeAndFragmentedHeapWhenAllChunksAreFreedThenWholeHeapCanBeAllocatedAgain) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 256 * 4096;
+    HeapAllocator heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold, HeapAllocatorMode::sizeClassBinned);
+
+    std::vector<uint64_t> ptrs;
+    for (uint32_t i = 0; i < 256; i++) {
+        size_t ptrSize = 4096;
+        auto ptr = heapAllocator.allocate(ptrSize);
+        ASSERT_NE(0llu, ptr);
+        ptrs.push_back(ptr);
+    }
+    size_t ptrSize = 4096;
+    EXPECT_EQ(0llu, heapAllocator.allocate(ptrSize));
+
+    for (size_t i = 0; i < ptrs.size(); i += 2) {
+        heapAllocator.free(ptrs[i], 4096);
+    }
+    ptrSize = 2 * 4096;
+    EXPECT_EQ(0llu, heapAllocator.allocate(ptrSize));
+
+    for (size_t i = 1; i < ptrs.size(); i += 2) {
+        heapAllocator.free(ptrs[i], 4096);
+    }
+    ptrSize = heapSize;
+    EXPECT_EQ(heapBase, heapAllocator.allocate(ptrSize));
+}
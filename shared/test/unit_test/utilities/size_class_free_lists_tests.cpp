@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/size_class_free_lists.h"
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+class SizeClassFreeListsUnderTest : public SizeClassFreeLists {
+  public:
+    using SizeClassFreeLists::SizeClassFreeLists;
+    using SizeClassFreeLists::firstLevelBitmap;
+    using SizeClassFreeLists::mapSizeToBin;
+};
+
+constexpr uint64_t heapBase = 0x100000llu;
+constexpr size_t granularity = MemoryConstants::pageSize;
+} // namespace
+
+TEST(SizeClassFreeListsTest, givenSmallSizesWhenMappingToBinThenEachGranuleHasOwnSecondLevelBin) {
+    SizeClassFreeListsUnderTest freeLists(granularity);
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+
+    for (uint32_t units = 0u; units < SizeClassFreeLists::secondLevelCount; units++) {
+        freeLists.mapSizeToBin(units * granularity, firstLevel, secondLevel);
+        EXPECT_EQ(0u, firstLevel);
+        EXPECT_EQ(units, secondLevel);
+    }
+
+    freeLists.mapSizeToBin(SizeClassFreeLists::secondLevelCount * granularity, firstLevel, secondLevel);
+    EXPECT_EQ(1u, firstLevel);
+    EXPECT_EQ(0u, secondLevel);
+
+    freeLists.mapSizeToBin((2 * SizeClassFreeLists::secondLevelCount - 1) * granularity, firstLevel, secondLevel);
+    EXPECT_EQ(1u, firstLevel);
+    EXPECT_EQ(SizeClassFreeLists::secondLevelCount - 1, secondLevel);
+}
+
+TEST(SizeClassFreeListsTest, givenEmptyFreeListsWhenAllocatingThenZeroIsReturned) {
+    SizeClassFreeListsUnderTest freeLists(granularity);
+    EXPECT_EQ(0llu, freeLists.allocate(granularity, granularity));
+    EXPECT_EQ(0u, freeLists.getLargestFreeBlockSize());
+    EXPECT_EQ(0u, freeLists.firstLevelBitmap);
+}
+
+TEST(SizeClassFreeListsTest, givenSingleFreeRangeWhenAllocatingThenRangeIsSplitAndRemainderStaysFree) {
+    SizeClassFreeListsUnderTest freeLists(granularity);
+    const size_t heapSize = 1024 * granularity;
+    freeLists.free(heapBase, heapSize);
+
+    auto ptr = freeLists.allocate(4 * granularity, granularity);
+    EXPECT_EQ(heapBase, ptr);
+    EXPECT_EQ(1u, freeLists.getNumFreeBlocks());
+    EXPECT_EQ(heapSize - 4 * granularity, freeLists.getLargestFreeBlockSize());
+
+    EXPECT_EQ(0llu, freeLists.allocate(heapSize, granularity));
+}
+
+TEST(SizeClassFreeListsTest, givenFreeBlockOfExactlyRequestedSizeWhenAllocatingThenBlockIsUsed) {
+    SizeClassFreeListsUnderTest freeLists(granularity);
+    const size_t blockSize = 33 * granularity;
+    freeLists.free(heapBase, blockSize);
+
+    EXPECT_EQ(heapBase, freeLists.allocate(blockSize, granularity));
+    EXPECT_EQ(0u, freeLists.getNumFreeBlocks());
+
+    freeLists.free(heapBase + granularity, blockSize);
+    EXPECT_EQ(0llu, freeLists.allocate(blockSize, 2 * granularity));
+    EXPECT_EQ(heapBase + 2 * granularity, freeLists.allocate(blockSize - granularity, 2 * granularity));
+    EXPECT_EQ(1u, freeLists.getNumFreeBlocks());
+}
+
+TEST(SizeClassFreeListsTest, givenAdjacentBlocksWhenFreedInAnyOrderThenTheyAreCoalescedImmediately) {
+    SizeClassFreeListsUnderTest freeLists(granularity);
+    const size_t heapSize = 64 * granularity;
+    freeLists.free(heapBase, heapSize);
+
+    auto ptr0 = freeLists.allocate(16 * granularity, granularity);
+    auto ptr1 = freeLists.allocate(16 * granularity, granularity);
+    auto ptr2 = freeLists.allocate(16 * granularity, granularity);
+    auto ptr3 = freeLists.allocate(16 * granularity, granularity);
+    EXPECT_EQ(0u, freeLists.getNumFreeBlocks());
+
+    freeLists.free(ptr0, 16 * granularity);
+    freeLists.free(ptr2, 16 * granularity);
+    EXPECT_EQ(2u, freeLists.getNumFreeBlocks());
+
+    freeLists.free(ptr1, 16 * granularity);
+    EXPECT_EQ(1u, freeLists.getNumFreeBlocks());
+    EXPECT_EQ(48 * granularity, freeLists.getLargestFreeBlockSize());
+
+    freeLists.free(ptr3, 16 * granularity);
+    EXPECT_EQ(1u, freeLists.getNumFreeBlocks());
+    EXPECT_EQ(heapSize, freeLists.getLargestFreeBlockSize());
+    EXPECT_EQ(heapBase, freeLists.allocate(heapSize, granularity));
+}
+
+TEST(SizeClassFreeListsTest, givenCustomAlignmentWhenAllocatingThenReturnedPointerIsAlignedAndPaddingStaysFree) {
+    SizeClassFreeListsUnderTest freeLists(granularity);
+    const uint64_t unalignedBase = heapBase + granularity;
+    const size_t heapSize = 1024 * granularity;
+    freeLists.free(unalignedBase, heapSize);
+
+    const size_t alignment = MemoryConstants::pageSize64k;
+    auto ptr = freeLists.allocate(granularity, alignment);
+    EXPECT_NE(0llu, ptr);
+    EXPECT_TRUE(isAligned(ptr, alignment));
+    EXPECT_EQ(2u, freeLists.getNumFreeBlocks());
+
+    freeLists.free(ptr, granularity);
+    EXPECT_EQ(1u, freeLists.getNumFreeBlocks());
+    EXPECT_EQ(heapSize, freeLists.getLargestFreeBlockSize());
+}
+
+TEST(SizeClassFreeListsTest, givenBlockStartNotAlignedToGranularityWhenAllocatingThenAlignedPointerIsReturned) {
+    SizeClassFreeListsUnderTest freeLists(granularity);
+    const uint64_t unalignedBase = 0x111111llu;
+    freeLists.free(unalignedBase, 4 * granularity);
+
+    auto ptr = freeLists.allocate(2 * granularity, granularity);
+    EXPECT_EQ(alignUp(unalignedBase, granularity), ptr);
+}
+
+TEST(SizeClassFreeListsTest, givenRandomAllocationsAndFreesWhenAllIsFreedThenWholeRangeIsCoalesced) {
+    SizeClassFreeListsUnderTest freeLists(granularity);
+    const size_t heapSize = 16 * MemoryConstants::megaByte;
+    freeLists.free(heapBase, heapSize);
+
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<size_t> sizeDistribution(1, 64);
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+
+    for (uint32_t i = 0; i < 2000; i++) {
+        if (!allocations.empty() && (generator() % 3 == 0)) {
+            auto index = generator() % allocations.size();
+            freeLists.free(allocations[index].first, allocations[index].second);
+            allocations.erase(allocations.begin() + index);
+            continue;
+        }
+        size_t size = sizeDistribution(generator) * granularity;
+        auto ptr = freeLists.allocate(size, granularity);
+        if (ptr != 0llu) {
+            EXPECT_GE(ptr, heapBase);
+            EXPECT_LE(ptr + size, heapBase + heapSize);
+            allocations.emplace_back(ptr, size);
+        }
+    }
+
+    for (auto &allocation : allocations) {
+        freeLists.free(allocation.first, allocation.second);
+    }
+    EXPECT_EQ(1u, freeLists.getNumFreeBlocks());
+    EXPECT_EQ(heapSize, freeLists.getLargestFreeBlockSize());
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/sorted_map.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+struct Data {
+    size_t size;
+};
+using TestedSortedMap = NEO::BaseSortedPointerWithValueMap<Data>;
+} // namespace
+
+TEST(SortedMapTest, givenEmptySortedMapWhenGettingPointerThenNullptrIsReturned) {
+    TestedSortedMap testedMap;
+    EXPECT_EQ(nullptr, testedMap.get(nullptr));
+    EXPECT_EQ(nullptr, testedMap.get(reinterpret_cast<void *>(0x1000)));
+    EXPECT_EQ(0u, testedMap.getNumAllocs());
+}
+
+TEST(SortedMapTest, givenSortedMapWhenInsertingOutOfOrderThenAllocationsAreKeptSorted) {
+    TestedSortedMap testedMap;
+    testedMap.insert(reinterpret_cast<void *>(0x3000), Data{0x100});
+    testedMap.insert(reinterpret_cast<void *>(0x1000), Data{0x100});
+    testedMap.insert(reinterpret_cast<void *>(0x2000), Data{0x100});
+
+    EXPECT_EQ(3u, testedMap.getNumAllocs());
+    uintptr_t expectedPtr = 0x1000;
+    for (auto &allocation : testedMap.allocations) {
+        EXPECT_EQ(expectedPtr, reinterpret_cast<uintptr_t>(allocation.first));
+        expectedPtr += 0x1000;
+    }
+}
+
+TEST(SortedMapTest, givenSortedMapWhenGettingPointerInsideAllocationThenAllocationIsReturned) {
+    TestedSortedMap testedMap;
+    testedMap.insert(reinterpret_cast<void *>(0x1000), Data{0x100});
+    testedMap.insert(reinterpret_cast<void *>(0x2000), Data{0x200});
+
+    auto data = testedMap.get(reinterpret_cast<void *>(0x2000));
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(0x200u, data->size);
+    EXPECT_EQ(data, testedMap.get(reinterpret_cast<void *>(0x2000 + 0x1FF)));
+
+    EXPECT_EQ(nullptr, testedMap.get(reinterpret_cast<void *>(0x2000 + 0x200)));
+    EXPECT_EQ(nullptr, testedMap.get(reinterpret_cast<void *>(0x1000 + 0x100)));
+    EXPECT_EQ(nullptr, testedMap.get(reinterpret_cast<void *>(0xFFF)));
+}
+
+TEST(SortedMapTest, givenSortedMapWhenRemovingPointerThenOnlyThisAllocationIsRemoved) {
+    TestedSortedMap testedMap;
+    testedMap.insert(reinterpret_cast<void *>(0x1000), Data{0x100});
+    testedMap.insert(reinterpret_cast<void *>(0x2000), Data{0x200});
+
+    testedMap.remove(reinterpret_cast<void *>(0x3000));
+    EXPECT_EQ(2u, testedMap.getNumAllocs());
+
+    testedMap.remove(reinterpret_cast<void *>(0x1000));
+    EXPECT_EQ(1u, testedMap.getNumAllocs());
+    EXPECT_EQ(nullptr, testedMap.get(reinterpret_cast<void *>(0x1000)));
+    EXPECT_NE(nullptr, testedMap.get(reinterpret_cast<void *>(0x2000)));
+}
+
+TEST(SortedMapTest, givenSortedMapWhenCallingExtractThenCorrectValueIsReturned) {
+    TestedSortedMap testedMap;
+    void *ptr = reinterpret_cast<void *>(0x1000);
+    testedMap.insert(ptr, Data{0x100});
+
+    EXPECT_EQ(nullptr, testedMap.extract(nullptr));
+    EXPECT_EQ(nullptr, testedMap.extract(reinterpret_cast<void *>(0x1010)));
+
+    auto valuePtr = testedMap.extract(ptr);
+    ASSERT_NE(nullptr, valuePtr);
+    EXPECT_EQ(0x100u, valuePtr->size);
+    EXPECT_EQ(nullptr, testedMap.extract(ptr));
+    EXPECT_EQ(0u, testedMap.getNumAllocs());
+}
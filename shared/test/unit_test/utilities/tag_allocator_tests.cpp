@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,9 @@
 #include "gtest/gtest.h"
 
 #include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -79,7 +82,11 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::deferredTags;
     using BaseClass::doNotReleaseNodes;
     using BaseClass::freeTags;
+    using BaseClass::freeTagsStackHead;
     using BaseClass::gfxAllocations;
+    using BaseClass::lockFreeFreeList;
+    using BaseClass::maxNodeChunks;
+    using BaseClass::nodeChunksCount;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
     using BaseClass::returnTagToDeferredPool;
@@ -439,6 +446,175 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
     EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty()); // empty again - new pool wasnt allocated
 }
 
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorWhenTakingAndReturningTagsThenFreeAndUsedListsAreNotUsed) {
+    EXPECT_FALSE(MockTagAllocator<TimeStamps>(memoryManager, 1, 1, deviceBitfield).lockFreeFreeList);
+
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1, deviceBitfield);
+    EXPECT_TRUE(tagAllocator.lockFreeFreeList);
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+    EXPECT_NE(0u, tagAllocator.freeTagsStackHead.load());
+
+    auto firstTag = tagAllocator.getTag();
+    auto secondTag = tagAllocator.getTag();
+    EXPECT_NE(firstTag, secondTag);
+    EXPECT_EQ(tagAllocator.getGraphicsAllocation()->getGpuAddress(), firstTag->getGpuAddress());
+    EXPECT_TRUE(tagAllocator.usedTags.peekIsEmpty());
+
+    tagAllocator.returnTag(secondTag);
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+    EXPECT_EQ(secondTag, tagAllocator.getTag());
+
+    tagAllocator.returnTag(secondTag);
+    tagAllocator.returnTag(firstTag);
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+}
+
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorWhenAllTagsAreTakenThenNewPoolIsPopulated) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1, deviceBitfield);
+
+    std::set<TagNodeBase *> tags;
+    for (auto i = 0u; i < 5u; i++) {
+        tags.insert(tagAllocator.getTag());
+    }
+    EXPECT_EQ(5u, tags.size());
+    EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+
+    for (auto tag : tags) {
+        tagAllocator.returnTag(tag);
+    }
+
+    std::set<TagNodeBase *> reusedTags;
+    for (auto i = 0u; i < 8u; i++) {
+        reusedTags.insert(tagAllocator.getTag());
+    }
+    EXPECT_EQ(8u, reusedTags.size());
+    EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
+    for (auto tag : reusedTags) {
+        tagAllocator.returnTag(tag);
+    }
+}
+
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorWithFullChunkTableWhenAllTagsAreTakenThenNewPoolUsesFreeAndUsedLists) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 1, deviceBitfield);
+    tagAllocator.nodeChunksCount = MockTagAllocator<TimeStamps>::maxNodeChunks;
+
+    auto firstTag = tagAllocator.getTag();
+    EXPECT_TRUE(tagAllocator.usedTags.peekIsEmpty());
+
+    auto secondTag = tagAllocator.getTag();
+    EXPECT_NE(firstTag, secondTag);
+    EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
+    EXPECT_EQ(MockTagAllocator<TimeStamps>::maxNodeChunks, tagAllocator.nodeChunksCount);
+    EXPECT_FALSE(tagAllocator.usedTags.peekIsEmpty());
+
+    tagAllocator.returnTag(secondTag);
+    EXPECT_TRUE(tagAllocator.usedTags.peekIsEmpty());
+    EXPECT_FALSE(tagAllocator.freeTags.peekIsEmpty());
+
+    tagAllocator.returnTag(firstTag);
+    EXPECT_NE(0u, static_cast<uint32_t>(tagAllocator.freeTagsStackHead.load()));
+
+    EXPECT_EQ(firstTag, tagAllocator.getTag());
+    EXPECT_EQ(secondTag, tagAllocator.getTag());
+    EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
+
+    secondTag->setDoNotReleaseNodes(true);
+    tagAllocator.returnTag(secondTag);
+    EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
+    secondTag->setDoNotReleaseNodes(false);
+    tagAllocator.releaseDeferredTags();
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.usedTags.peekIsEmpty());
+    EXPECT_FALSE(tagAllocator.freeTags.peekIsEmpty());
+
+    tagAllocator.returnTag(firstTag);
+}
+
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorAndMultipleReferencesOnTagWhenReleasingThenTagIsReusedAfterLastReference) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 1, deviceBitfield);
+
+    auto tag = tagAllocator.getTag();
+    tag->incRefCount();
+    tagAllocator.returnTag(tag);
+    EXPECT_EQ(0u, static_cast<uint32_t>(tagAllocator.freeTagsStackHead.load()));
+
+    tagAllocator.returnTag(tag);
+    EXPECT_NE(0u, static_cast<uint32_t>(tagAllocator.freeTagsStackHead.load()));
+    EXPECT_EQ(tag, tagAllocator.getTag());
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+    tagAllocator.returnTag(tag);
+}
+
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorWhenNotReleasableTagIsReturnedThenItIsDeferredUntilItCanBeReleased) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 1, deviceBitfield);
+
+    auto tag = tagAllocator.getTag();
+    tag->setDoNotReleaseNodes(true);
+    tagAllocator.returnTag(tag);
+    EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
+
+    tagAllocator.releaseDeferredTags();
+    EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
+
+    tag->setDoNotReleaseNodes(false);
+    EXPECT_EQ(tag, tagAllocator.getTag());
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+    tagAllocator.returnTag(tag);
+}
+
+TEST_F(TagAllocatorTest, givenLockFreeTagAllocatorWhenTagsAreTakenFromMultipleThreadsThenEachTagIsOwnedByOneThreadAtTime) {
+    debugManager.flags.EnableLockFreeTagAllocator.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 16, 1, deviceBitfield);
+
+    constexpr uint32_t threadsCount = 8;
+    constexpr uint32_t iterationsCount = 500;
+    constexpr uint32_t tagsPerIteration = 4;
+    std::atomic<uint32_t> ownershipErrors{0};
+
+    auto issueTags = [&](uint64_t threadId) {
+        std::vector<TagNodeBase *> tags(tagsPerIteration);
+        for (auto iteration = 0u; iteration < iterationsCount; iteration++) {
+            for (auto &tag : tags) {
+                tag = tagAllocator.getTag();
+                static_cast<TagNode<TimeStamps> *>(tag)->tagForCpuAccess->start = threadId;
+            }
+            for (auto &tag : tags) {
+                if (static_cast<TagNode<TimeStamps> *>(tag)->tagForCpuAccess->start != threadId) {
+                    ownershipErrors++;
+                }
+                tagAllocator.returnTag(tag);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (auto i = 0u; i < threadsCount; i++) {
+        threads.emplace_back(issueTags, 0x100u + i);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, ownershipErrors.load());
+    EXPECT_LE(tagAllocator.getTagPoolCount(), threadsCount * tagsPerIteration / 16);
+
+    std::set<TagNodeBase *> tags;
+    for (auto i = 0u; i < tagAllocator.getTagPoolCount() * 16; i++) {
+        tags.insert(tagAllocator.getTag());
+    }
+    EXPECT_EQ(tagAllocator.getTagPoolCount() * 16, tags.size());
+    for (auto tag : tags) {
+        tagAllocator.returnTag(tag);
+    }
+}
+
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
     MockTagAllocator<TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>> timestampPacketAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>), false, mockDeviceBitfield);
     MockTagAllocator<HwTimeStamps> hwTimeStampsAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(HwTimeStamps), false, mockDeviceBitfield);
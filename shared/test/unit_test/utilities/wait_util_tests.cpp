@@ -98,3 +98,102 @@ TEST_F(WaitPredicateOnlyTest, givenDebugFlagSetZeroWhenPollAddressProvidedMeetsC
     EXPECT_TRUE(ret);
     EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
 }
+
+struct AdaptiveWaitFixture : public WaitPredicateOnlyFixture {
+    void setUp() {
+        WaitPredicateOnlyFixture::setUp();
+        backupWaitPolicy = std::make_unique<VariableBackup<WaitUtils::WaitPolicy>>(&WaitUtils::waitPolicy);
+        backupSpinTime = std::make_unique<VariableBackup<int64_t>>(&WaitUtils::adaptiveSpinTime);
+        backupSleepTime = std::make_unique<VariableBackup<int64_t>>(&WaitUtils::adaptiveSleepTime);
+    }
+
+    std::unique_ptr<VariableBackup<WaitUtils::WaitPolicy>> backupWaitPolicy;
+    std::unique_ptr<VariableBackup<int64_t>> backupSpinTime;
+    std::unique_ptr<VariableBackup<int64_t>> backupSleepTime;
+};
+
+using AdaptiveWaitTest = Test<AdaptiveWaitFixture>;
+
+TEST_F(AdaptiveWaitTest, givenDebugFlagsWhenInitializingThenWaitPolicyAndAdaptiveTimesAreOverridden) {
+    WaitUtils::init();
+    EXPECT_EQ(WaitUtils::WaitPolicy::fixed, WaitUtils::waitPolicy);
+    EXPECT_EQ(WaitUtils::defaultAdaptiveSpinTime, WaitUtils::adaptiveSpinTime);
+    EXPECT_EQ(WaitUtils::defaultAdaptiveSleepTime, WaitUtils::adaptiveSleepTime);
+
+    debugManager.flags.WaitPolicy.set(1);
+    debugManager.flags.AdaptiveWaitSpinTime.set(5);
+    debugManager.flags.AdaptiveWaitSleepTime.set(50);
+    WaitUtils::init();
+    EXPECT_EQ(WaitUtils::WaitPolicy::adaptive, WaitUtils::waitPolicy);
+    EXPECT_EQ(5, WaitUtils::adaptiveSpinTime);
+    EXPECT_EQ(50, WaitUtils::adaptiveSleepTime);
+}
+
+TEST_F(AdaptiveWaitTest, givenNoWaitHistoryWhenWaitTakesLongerThenPhaseEscalatesFromSpinToMonitorToSleep) {
+    WaitUtils::adaptiveSpinTime = 10;
+    WaitUtils::adaptiveSleepTime = 100;
+    WaitUtils::AdaptiveWaitState waitState;
+
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::spin, waitState.getPhase(0));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::spin, waitState.getPhase(9));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::monitor, waitState.getPhase(10));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::monitor, waitState.getPhase(99));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::sleep, waitState.getPhase(100));
+}
+
+TEST_F(AdaptiveWaitTest, givenLongExpectedLatencyWhenWaitingThenSleepUntilCompletionIsCloseAndMonitorAroundExpectedCompletion) {
+    WaitUtils::adaptiveSpinTime = 10;
+    WaitUtils::adaptiveSleepTime = 100;
+    WaitUtils::AdaptiveWaitState waitState;
+    waitState.recordWait(1000, WaitUtils::AdaptiveWaitState::Phase::sleep);
+
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::spin, waitState.getPhase(0));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::sleep, waitState.getPhase(10));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::sleep, waitState.getPhase(899));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::monitor, waitState.getPhase(900));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::monitor, waitState.getPhase(2099));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitState::Phase::sleep, waitState.getPhase(2100));
+}
+
+TEST_F(AdaptiveWaitTest, givenRecordedWaitsWhenGettingStatisticsThenExpectedLatencyIsMovingAverageAndCompletionsArePerPhase) {
+    WaitUtils::AdaptiveWaitState waitState;
+    auto statistics = waitState.getStatistics();
+    EXPECT_EQ(0u, statistics.waits);
+    EXPECT_EQ(0, statistics.expectedLatency);
+
+    waitState.recordWait(800, WaitUtils::AdaptiveWaitState::Phase::monitor);
+    EXPECT_EQ(800, waitState.getStatistics().expectedLatency);
+
+    waitState.recordWait(0, WaitUtils::AdaptiveWaitState::Phase::spin);
+    waitState.recordWait(0, WaitUtils::AdaptiveWaitState::Phase::spin);
+    statistics = waitState.getStatistics();
+    EXPECT_EQ(3u, statistics.waits);
+    EXPECT_EQ(613, statistics.expectedLatency);
+    EXPECT_EQ(2u, statistics.completions[static_cast<uint32_t>(WaitUtils::AdaptiveWaitState::Phase::spin)]);
+    EXPECT_EQ(1u, statistics.completions[static_cast<uint32_t>(WaitUtils::AdaptiveWaitState::Phase::monitor)]);
+    EXPECT_EQ(0u, statistics.completions[static_cast<uint32_t>(WaitUtils::AdaptiveWaitState::Phase::sleep)]);
+}
+
+TEST_F(AdaptiveWaitTest, givenSpinPhaseWhenWaitingThenPauseAndCheckPredicate) {
+    WaitUtils::init();
+
+    volatile TagAddressType pollValue = 1u;
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    EXPECT_FALSE(WaitUtils::adaptiveWaitFunction(&pollValue, 3u, WaitUtils::AdaptiveWaitState::Phase::spin));
+    EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
+
+    pollValue = 3u;
+    EXPECT_TRUE(WaitUtils::adaptiveWaitFunction(&pollValue, 3u, WaitUtils::AdaptiveWaitState::Phase::spin));
+    EXPECT_TRUE(WaitUtils::adaptiveWaitFunctionWithPredicate<const TagAddressType>(&pollValue, 1u, std::not_equal_to<TagAddressType>(), WaitUtils::AdaptiveWaitState::Phase::monitor));
+}
+
+TEST_F(AdaptiveWaitTest, givenSleepPhaseWhenWaitingThenDoNotPauseAndCheckPredicate) {
+    WaitUtils::init();
+    WaitUtils::adaptiveSleepTime = 0;
+
+    volatile TagAddressType pollValue = 3u;
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    EXPECT_TRUE(WaitUtils::adaptiveWaitFunction(&pollValue, 3u, WaitUtils::AdaptiveWaitState::Phase::sleep));
+    EXPECT_FALSE(WaitUtils::adaptiveWaitFunction(nullptr, 3u, WaitUtils::AdaptiveWaitState::Phase::sleep));
+    EXPECT_EQ(oldCount, CpuIntrinsicsTests::pauseCounter);
+}